@@ -129,6 +129,20 @@ namespace Utilities
           partitioner_export_start,
           partitioner_export_end = partitioner_export_start + 200,
 
+          /// 400 tags for the ready and done signals of
+          /// LinearAlgebra::distributed::Vector::update_ghost_values() through
+          /// shared memory
+          shared_memory_ghost_export_start,
+          shared_memory_ghost_export_end =
+            shared_memory_ghost_export_start + 400,
+
+          /// 400 tags for the ready and done signals of
+          /// LinearAlgebra::distributed::Vector::compress() through shared
+          /// memory
+          shared_memory_ghost_import_start,
+          shared_memory_ghost_import_end =
+            shared_memory_ghost_import_start + 400,
+
           /// NoncontiguousPartitioner::update_values
           noncontiguous_partitioner_update_ghost_values_start,
           noncontiguous_partitioner_update_ghost_values_end =
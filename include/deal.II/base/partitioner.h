@@ -422,6 +422,31 @@ namespace Utilities
       const std::vector<std::pair<unsigned int, unsigned int>> &
       import_targets() const;
 
+      /**
+       * Return the ranges of local indices of the locally owned range that
+       * are not ghosts on any other processor, in the format of
+       * import_indices(). Together with locally_owned_boundary_ranges(), these
+       * ranges form a disjoint partition of the locally owned range.
+       *
+       * If the ghost indices of all processors are set up from the couplings
+       * of a symmetric operator, e.g., as the locally relevant degrees of
+       * freedom of a finite element discretization, the rows of the operator
+       * in these ranges only couple to locally owned indices. They can hence
+       * be computed while the ghost values are still being exchanged, see
+       * LinearAlgebra::distributed::Vector::update_ghost_values_overlapped().
+       */
+      const std::vector<std::pair<unsigned int, unsigned int>> &
+      locally_owned_interior_ranges() const;
+
+      /**
+       * Return the ranges of local indices of the locally owned range that
+       * are ghosts on at least one other processor. This is the same set of
+       * indices as import_indices(), but with the ranges sorted, merged, and
+       * without duplicates.
+       */
+      const std::vector<std::pair<unsigned int, unsigned int>> &
+      locally_owned_boundary_ranges() const;
+
       /**
        * Check whether the given partitioner is compatible with the current
        * partitioner. Two partitioners are compatible if
@@ -677,6 +702,13 @@ namespace Utilities
       void
       initialize_import_indices_plain_dev() const;
 
+      /**
+       * Compute the variables interior_ranges_data and boundary_ranges_data
+       * from import_indices_data.
+       */
+      void
+      initialize_interior_and_boundary_ranges();
+
       /**
        * The global size of the vector over all processors
        */
@@ -750,6 +782,18 @@ namespace Utilities
        */
       std::vector<unsigned int> import_indices_chunks_by_rank_data;
 
+      /**
+       * The ranges of locally owned indices that are not ghosts on other
+       * processors.
+       */
+      std::vector<std::pair<unsigned int, unsigned int>> interior_ranges_data;
+
+      /**
+       * The ranges of locally owned indices that are ghosts on other
+       * processors, sorted and merged.
+       */
+      std::vector<std::pair<unsigned int, unsigned int>> boundary_ranges_data;
+
       /**
        * A variable caching the number of ghost indices in a larger set of
        * indices given by the optional argument to set_ghost_indices().
@@ -942,6 +986,22 @@ namespace Utilities
 
 
 
+    inline const std::vector<std::pair<unsigned int, unsigned int>> &
+    Partitioner::locally_owned_interior_ranges() const
+    {
+      return interior_ranges_data;
+    }
+
+
+
+    inline const std::vector<std::pair<unsigned int, unsigned int>> &
+    Partitioner::locally_owned_boundary_ranges() const
+    {
+      return boundary_ranges_data;
+    }
+
+
+
     inline const std::vector<std::pair<unsigned int, unsigned int>> &
     Partitioner::import_targets() const
     {
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 
 // Note:
 // The flag DEAL_II_VECTORIZATION_WIDTH_IN_BITS is essentially constructed
@@ -673,6 +674,19 @@ public:
     data = base_ptr[offsets[0]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const Number *base_ptr, const std::uint16_t *offsets)
+  {
+    data = base_ptr[offsets[0]];
+  }
+
   /**
    * Write the content of the calling class into memory in form of
    * size() data items to the given address and the given offsets, filling the
@@ -1205,6 +1219,19 @@ public:
       *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  void
+  gather(const double *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 2; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -1490,6 +1517,19 @@ public:
       *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  void
+  gather(const float *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 4; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -1827,6 +1867,20 @@ public:
       *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const double *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 2; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -2312,6 +2366,20 @@ public:
       *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const float *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 4; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -2873,6 +2941,32 @@ public:
 #    endif
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const double *base_ptr, const std::uint16_t *offsets)
+  {
+#    if defined(__AVX2__) && defined(DEAL_II_USE_VECTORIZATION_GATHER)
+    // load the four offsets into the lower 64 bits of a register and
+    // zero-extend them to 32-bit integers
+    const __m128i index = _mm_cvtepu16_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i *>(offsets)));
+
+    __m256d zero = _mm256_setzero_pd();
+    __m256d mask = _mm256_cmp_pd(zero, zero, _CMP_EQ_OQ);
+
+    data = _mm256_mask_i32gather_pd(zero, base_ptr, index, mask, 8);
+#    else
+    for (unsigned int i = 0; i < 4; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+#    endif
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -3454,6 +3548,30 @@ public:
 #    endif
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const float *base_ptr, const std::uint16_t *offsets)
+  {
+#    if defined(__AVX2__) && defined(DEAL_II_USE_VECTORIZATION_GATHER)
+    const __m256i index = _mm256_cvtepu16_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(offsets)));
+
+    __m256 zero = _mm256_setzero_ps();
+    __m256 mask = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+
+    data = _mm256_mask_i32gather_ps(zero, base_ptr, index, mask, 4);
+#    else
+    for (unsigned int i = 0; i < 8; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+#    endif
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -4087,6 +4205,30 @@ public:
 #    endif
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const double *base_ptr, const std::uint16_t *offsets)
+  {
+#    ifdef DEAL_II_USE_VECTORIZATION_GATHER
+    const __m256i index = _mm256_cvtepu16_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(offsets)));
+
+    __m512d  zero = {};
+    __mmask8 mask = 0xFF;
+
+    data = _mm512_mask_i32gather_pd(zero, mask, index, base_ptr, 8);
+#    else
+    for (unsigned int i = 0; i < 8; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+#    endif
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -4719,6 +4861,30 @@ public:
 #    endif
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const float *base_ptr, const std::uint16_t *offsets)
+  {
+#    ifdef DEAL_II_USE_VECTORIZATION_GATHER
+    const __m512i index = _mm512_cvtepu16_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets)));
+
+    __m512    zero = {};
+    __mmask16 mask = 0xFFFF;
+
+    data = _mm512_mask_i32gather_ps(zero, mask, index, base_ptr, 4);
+#    else
+    for (unsigned int i = 0; i < 16; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+#    endif
+  }
+
   /**
    * Write the content of the calling class into memory in form of @p
    * size() to the given address and the given offsets, filling the
@@ -5391,6 +5557,20 @@ public:
       *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const double *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 2; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * @copydoc VectorizedArray<Number>::scatter
    */
@@ -5652,6 +5832,20 @@ public:
       *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
   }
 
+  /**
+   * Same as gather() above, but with the offsets given as 16-bit integers,
+   * which halves the memory traffic for offsets stored in arrays. If the
+   * hardware provides a gather instruction, the offsets are zero-extended to
+   * 32-bit integers in registers.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  gather(const float *base_ptr, const std::uint16_t *offsets)
+  {
+    for (unsigned int i = 0; i < 4; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
   /**
    * @copydoc VectorizedArray<Number>::scatter
    */
@@ -0,0 +1,554 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#ifndef dealii_fused_vector_operations_h
+#define dealii_fused_vector_operations_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declarations
+#ifndef DOXYGEN
+template <typename Number>
+class Vector;
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
+
+namespace LinearAlgebra
+{
+  /**
+   * A class that collects a sequence of element-wise vector updates and
+   * inner products and evaluates them in a single sweep through the vectors.
+   *
+   * Iterative solvers typically perform several vector operations in a row,
+   * such as updating the solution and the residual and then computing the
+   * norm of the new residual. When each of these operations is done by a
+   * separate call to a vector function, every call reads (and writes) all
+   * involved vectors from main memory. Since these operations are limited by
+   * the memory bandwidth, the number of vector sweeps directly determines
+   * their cost. This class records the operations instead, and executes them
+   * in execute() by working on chunks of a few hundred entries at a time: All
+   * recorded updates are applied to a chunk in the order in which they were
+   * added, followed by the contributions of the chunk to all requested inner
+   * products. A vector that appears in several operations is thus read from
+   * main memory only once, and all inner products are summed in a single
+   * global reduction.
+   *
+   * As an example, the update of the solution $x$ and the residual $r$ in
+   * the conjugate gradient method, followed by the residual norm and the
+   * inner product with a second vector, can be written as
+   * @code
+   * LinearAlgebra::FusedVectorOperations<VectorType> operations;
+   * operations.add(x, alpha, p);
+   * operations.add(r, -alpha, v);
+   * const unsigned int r_dot_r = operations.dot(r, r);
+   * const unsigned int r_dot_z = operations.dot(r, z);
+   * const auto &results = operations.execute();
+   * const double residual_norm = std::sqrt(results[r_dot_r]);
+   * @endcode
+   *
+   * The result is the same as if the operations had been run one after
+   * another, except for round-off in the inner products, which are
+   * accumulated chunk by chunk. The order of the summation does not depend
+   * on the number of threads, so the results are reproducible, but it
+   * differs from the one of the inner products of the vector classes. As a
+   * consequence, solvers using this class may show differences in the last
+   * digits of residuals compared to an evaluation with separate vector
+   * operations, and, in rare cases close to the convergence threshold, a
+   * different number of iterations.
+   *
+   * Vectors with ghost elements can be updated: As for the vector functions,
+   * the ghost values of such vectors are updated after the sweep.
+   *
+   * The fused evaluation is available for Vector and for
+   * LinearAlgebra::distributed::Vector with data on the host. For all other
+   * vector types, execute() runs the recorded operations one by one with the
+   * functions of the vector class, merging an update with a subsequent inner
+   * product through the add_and_dot() function of the vector where possible,
+   * such that solvers can use this class independently of the vector type.
+   *
+   * @ingroup Vectors
+   */
+  template <typename VectorType>
+  class FusedVectorOperations
+  {
+  public:
+    /**
+     * The type of the vector entries.
+     */
+    using Number = typename VectorType::value_type;
+
+    /**
+     * Record the update $x = s x + a v$. If @p s is zero, the previous
+     * content of @p x is not read.
+     */
+    FusedVectorOperations &
+    sadd(VectorType &x, const Number s, const Number a, const VectorType &v);
+
+    /**
+     * Record the update $x = s x + a v + b w$. If @p s is zero, the previous
+     * content of @p x is not read.
+     */
+    FusedVectorOperations &
+    sadd(VectorType       &x,
+         const Number      s,
+         const Number      a,
+         const VectorType &v,
+         const Number      b,
+         const VectorType &w);
+
+    /**
+     * Record the update $x \mathrel{+}= a v$.
+     */
+    FusedVectorOperations &
+    add(VectorType &x, const Number a, const VectorType &v);
+
+    /**
+     * Record the update $x \mathrel{+}= a v + b w$.
+     */
+    FusedVectorOperations &
+    add(VectorType       &x,
+        const Number      a,
+        const VectorType &v,
+        const Number      b,
+        const VectorType &w);
+
+    /**
+     * Record the assignment $x = a v$.
+     */
+    FusedVectorOperations &
+    equ(VectorType &x, const Number a, const VectorType &v);
+
+    /**
+     * Record the computation of the inner product $u \cdot w$ with the
+     * values of the vectors after all updates recorded so far (or later,
+     * since the inner products are always evaluated after the updates of a
+     * chunk). As for the vector classes, the complex conjugate of @p w is
+     * taken for complex numbers. Returns the index of the result in the
+     * array returned by execute().
+     */
+    unsigned int
+    dot(const VectorType &u, const VectorType &w);
+
+    /**
+     * Run all recorded operations in a single sweep through the vectors and
+     * return the inner products in the order in which they were requested.
+     * The recorded operations are cleared, such that the object can be
+     * reused. The returned reference stays valid until the next call to
+     * execute().
+     */
+    const std::vector<Number> &
+    execute();
+
+    /**
+     * Number of vector entries processed together for all operations. This
+     * is small enough that the chunks of all vectors involved in typical
+     * solver updates fit into the level-1 cache.
+     */
+    static constexpr unsigned int chunk_size = 512;
+
+  private:
+    /**
+     * Representation of an update $x = s x + a v + b w$, with @p w being
+     * optional.
+     */
+    struct Update
+    {
+      VectorType       *x;
+      Number            s;
+      Number            a;
+      const VectorType *v;
+      Number            b;
+      const VectorType *w;
+    };
+
+    /**
+     * The recorded updates.
+     */
+    std::vector<Update> updates;
+
+    /**
+     * The recorded inner products.
+     */
+    std::vector<std::pair<const VectorType *, const VectorType *>> products;
+
+    /**
+     * The results of the inner products of the last call to execute().
+     */
+    std::vector<Number> results;
+  };
+
+} // namespace LinearAlgebra
+
+
+/*----------------------- Inline functions ----------------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace FusedVectorOperationsImplementation
+  {
+    // a helper type-trait to select the vector types whose locally owned
+    // entries are stored contiguously on the host
+    template <typename VectorType>
+    struct is_supported_vector : std::false_type
+    {};
+
+    template <typename Number>
+    struct is_supported_vector<::dealii::Vector<Number>> : std::true_type
+    {};
+
+    template <typename Number>
+    struct is_supported_vector<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+      : std::true_type
+    {};
+
+
+
+    // inner product of the entries [begin, end) of two arrays
+    template <typename Number>
+    Number
+    local_dot(const Number      *u,
+              const Number      *w,
+              const unsigned int begin,
+              const unsigned int end)
+    {
+      if constexpr (numbers::NumberTraits<Number>::is_complex)
+        {
+          Number sum = Number();
+          for (unsigned int i = begin; i < end; ++i)
+            sum += u[i] * numbers::NumberTraits<Number>::conjugate(w[i]);
+          return sum;
+        }
+      else
+        {
+          constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+          VectorizedArray<Number> sums[4] = {};
+          unsigned int            i       = begin;
+          for (; i + 4 * n_lanes <= end; i += 4 * n_lanes)
+            for (unsigned int k = 0; k < 4; ++k)
+              {
+                VectorizedArray<Number> u_vec, w_vec;
+                u_vec.load(u + i + k * n_lanes);
+                w_vec.load(w + i + k * n_lanes);
+                sums[k] += u_vec * w_vec;
+              }
+          Number sum = ((sums[0] + sums[1]) + (sums[2] + sums[3])).sum();
+          for (; i < end; ++i)
+            sum += u[i] * w[i];
+          return sum;
+        }
+    }
+  } // namespace FusedVectorOperationsImplementation
+} // namespace internal
+
+
+
+namespace LinearAlgebra
+{
+  template <typename VectorType>
+  inline FusedVectorOperations<VectorType> &
+  FusedVectorOperations<VectorType>::sadd(VectorType       &x,
+                                          const Number      s,
+                                          const Number      a,
+                                          const VectorType &v)
+  {
+    updates.push_back(Update{&x, s, a, &v, Number(), nullptr});
+    return *this;
+  }
+
+
+
+  template <typename VectorType>
+  inline FusedVectorOperations<VectorType> &
+  FusedVectorOperations<VectorType>::sadd(VectorType       &x,
+                                          const Number      s,
+                                          const Number      a,
+                                          const VectorType &v,
+                                          const Number      b,
+                                          const VectorType &w)
+  {
+    updates.push_back(Update{&x, s, a, &v, b, &w});
+    return *this;
+  }
+
+
+
+  template <typename VectorType>
+  inline FusedVectorOperations<VectorType> &
+  FusedVectorOperations<VectorType>::add(VectorType       &x,
+                                         const Number      a,
+                                         const VectorType &v)
+  {
+    return sadd(x, Number(1.), a, v);
+  }
+
+
+
+  template <typename VectorType>
+  inline FusedVectorOperations<VectorType> &
+  FusedVectorOperations<VectorType>::add(VectorType       &x,
+                                         const Number      a,
+                                         const VectorType &v,
+                                         const Number      b,
+                                         const VectorType &w)
+  {
+    return sadd(x, Number(1.), a, v, b, w);
+  }
+
+
+
+  template <typename VectorType>
+  inline FusedVectorOperations<VectorType> &
+  FusedVectorOperations<VectorType>::equ(VectorType       &x,
+                                         const Number      a,
+                                         const VectorType &v)
+  {
+    return sadd(x, Number(), a, v);
+  }
+
+
+
+  template <typename VectorType>
+  inline unsigned int
+  FusedVectorOperations<VectorType>::dot(const VectorType &u,
+                                         const VectorType &w)
+  {
+    products.emplace_back(&u, &w);
+    return products.size() - 1;
+  }
+
+
+
+  template <typename VectorType>
+  const std::vector<typename VectorType::value_type> &
+  FusedVectorOperations<VectorType>::execute()
+  {
+    results.assign(products.size(), Number());
+
+    if constexpr (dealii::internal::FusedVectorOperationsImplementation::
+                    is_supported_vector<VectorType>::value)
+      {
+        if (updates.empty() && products.empty())
+          return results;
+
+        const VectorType &first =
+          updates.empty() ? *products[0].first : *updates[0].x;
+        const unsigned int size = first.locally_owned_size();
+
+        // collect the raw pointers of all operations
+        struct UpdatePointers
+        {
+          Number       *x;
+          Number        s;
+          Number        a;
+          const Number *v;
+          Number        b;
+          const Number *w;
+        };
+        std::vector<UpdatePointers> update_pointers;
+        update_pointers.reserve(updates.size());
+        std::vector<const VectorType *> ghosted_vectors;
+        for (const Update &update : updates)
+          {
+            AssertDimension(update.x->locally_owned_size(), size);
+            AssertDimension(update.v->locally_owned_size(), size);
+            if (update.x->has_ghost_elements() &&
+                std::find(ghosted_vectors.begin(),
+                          ghosted_vectors.end(),
+                          update.x) == ghosted_vectors.end())
+              ghosted_vectors.push_back(update.x);
+            if (update.w != nullptr)
+              AssertDimension(update.w->locally_owned_size(), size);
+            update_pointers.push_back(
+              UpdatePointers{update.x->begin(),
+                             update.s,
+                             update.a,
+                             update.v->begin(),
+                             update.b,
+                             update.w != nullptr ? update.w->begin() :
+                                                   nullptr});
+          }
+        std::vector<std::pair<const Number *, const Number *>> product_pointers;
+        product_pointers.reserve(products.size());
+        for (const auto &product : products)
+          {
+            AssertDimension(product.first->locally_owned_size(), size);
+            AssertDimension(product.second->locally_owned_size(), size);
+            product_pointers.emplace_back(product.first->begin(),
+                                          product.second->begin());
+          }
+
+        using dealii::internal::FusedVectorOperationsImplementation::local_dot;
+
+        const unsigned int n_products = products.size();
+        const unsigned int n_chunks   = (size + chunk_size - 1) / chunk_size;
+
+        // the contributions of each chunk to the inner products, summed in a
+        // fixed order after the parallel loop to make the result independent
+        // of the number of threads
+        std::vector<Number> chunk_results(n_chunks * n_products);
+
+        parallel::apply_to_subranges(
+          0U,
+          n_chunks,
+          [&](const unsigned int chunk_begin, const unsigned int chunk_end) {
+            for (unsigned int c = chunk_begin; c < chunk_end; ++c)
+              {
+                const unsigned int begin = c * chunk_size;
+                const unsigned int end   = std::min(begin + chunk_size, size);
+                for (const UpdatePointers &u : update_pointers)
+                  {
+                    Number *const       x = u.x;
+                    const Number *const v = u.v;
+                    const Number *const w = u.w;
+                    const Number        s = u.s, a = u.a, b = u.b;
+                    if (s == Number() && w == nullptr)
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (unsigned int i = begin; i < end; ++i)
+                          x[i] = a * v[i];
+                      }
+                    else if (s == Number())
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (unsigned int i = begin; i < end; ++i)
+                          x[i] = a * v[i] + b * w[i];
+                      }
+                    else if (w == nullptr)
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (unsigned int i = begin; i < end; ++i)
+                          x[i] = s * x[i] + a * v[i];
+                      }
+                    else
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (unsigned int i = begin; i < end; ++i)
+                          x[i] = s * x[i] + a * v[i] + b * w[i];
+                      }
+                  }
+                for (unsigned int p = 0; p < n_products; ++p)
+                  chunk_results[c * n_products + p] =
+                    local_dot(product_pointers[p].first,
+                              product_pointers[p].second,
+                              begin,
+                              end);
+              }
+          },
+          std::max<unsigned int>(1,
+                                 dealii::internal::VectorImplementation::
+                                     minimum_parallel_grain_size /
+                                   chunk_size));
+
+        for (unsigned int c = 0; c < n_chunks; ++c)
+          for (unsigned int p = 0; p < n_products; ++p)
+            results[p] += chunk_results[c * n_products + p];
+
+        if (n_products > 0)
+          Utilities::MPI::sum(ArrayView<const Number>(results),
+                              first.get_mpi_communicator(),
+                              ArrayView<Number>(results));
+
+        // only the locally owned entries have been updated, so bring the
+        // ghost entries in sync as done by the vector functions
+        for (const VectorType *vector : ghosted_vectors)
+          vector->update_ghost_values();
+      }
+    else
+      {
+        // run the operations one by one. an inner product that involves the
+        // result of an update of the form x += a v, with no later update
+        // writing to the two vectors of the inner product, is computed
+        // together with the update through add_and_dot()
+        std::vector<bool> product_done(products.size(), false);
+        for (unsigned int u = 0; u < updates.size(); ++u)
+          {
+            const Update &update = updates[u];
+            if (update.s == Number())
+              update.x->equ(update.a, *update.v);
+            else if (update.s == Number(1.) && update.w == nullptr)
+              {
+                const auto is_written_later = [&](const VectorType *vector) {
+                  for (unsigned int l = u + 1; l < updates.size(); ++l)
+                    if (updates[l].x == vector)
+                      return true;
+                  return false;
+                };
+                unsigned int p = 0;
+                for (; p < products.size(); ++p)
+                  if (products[p].first == update.x && !product_done[p] &&
+                      !is_written_later(products[p].first) &&
+                      !is_written_later(products[p].second))
+                    break;
+                if (p < products.size())
+                  {
+                    results[p] = update.x->add_and_dot(update.a,
+                                                       *update.v,
+                                                       *products[p].second);
+                    product_done[p] = true;
+                  }
+                else
+                  update.x->add(update.a, *update.v);
+                continue;
+              }
+            else if (update.s == Number(1.))
+              {
+                update.x->add(update.a, *update.v, update.b, *update.w);
+                continue;
+              }
+            else
+              update.x->sadd(update.s, update.a, *update.v);
+            if (update.w != nullptr)
+              update.x->add(update.b, *update.w);
+          }
+        for (unsigned int p = 0; p < products.size(); ++p)
+          if (!product_done[p])
+            results[p] = *products[p].first * *products[p].second;
+      }
+
+    updates.clear();
+    products.clear();
+
+    return results;
+  }
+} // namespace LinearAlgebra
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -29,6 +29,7 @@
 #include <deal.II/lac/vector_operation.h>
 #include <deal.II/lac/vector_type_traits.h>
 
+#include <functional>
 #include <iomanip>
 #include <memory>
 
@@ -58,6 +59,14 @@ namespace LinearAlgebra
   class ReadWriteVector;
 } // namespace LinearAlgebra
 
+namespace internal
+{
+  namespace LinearAlgebraDistributedVector
+  {
+    class SharedMemoryGhostExchange;
+  }
+} // namespace internal
+
 #  ifdef DEAL_II_WITH_PETSC
 namespace PETScWrappers
 {
@@ -240,6 +249,15 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * By default, update_ghost_values() and compress() exchange all ghost
+     * data through MPI messages, also between processes in the same
+     * shared-memory domain. After a call to
+     * enable_shared_memory_ghost_exchange(), these functions instead read
+     * the data of the processes in the shared-memory communicator directly
+     * from their memory, and only send messages to processes on other
+     * nodes. This avoids packing the data into buffers and copying it
+     * through the MPI library for the intra-node part of the exchange.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>
@@ -652,6 +670,73 @@ namespace LinearAlgebra
       void
       update_ghost_values_finish() const;
 
+      /**
+       * Let update_ghost_values() and compress() exchange the data with the
+       * processes of the shared-memory communicator given to reinit()
+       * through the shared memory, rather than through MPI messages. The
+       * ghost values are then copied directly from the memory of the
+       * owning process, and the contributions to be added by compress() are
+       * read directly from the ghost entries of the other processes. Data of
+       * processes outside the shared-memory domain is still sent through MPI
+       * messages. The shared-memory path of compress() is only used for
+       * VectorOperation::add, other operations use the default MPI path.
+       *
+       * In order to make sure that no process modifies its data while
+       * another process is still reading it, update_ghost_values_finish()
+       * and compress_finish() wait until the processes reading data of the
+       * present process have signaled that they are done. Only processes
+       * that actually exchange data synchronize in this way.
+       *
+       * This function must be called collectively by all processes of the
+       * communicator of the partitioner, after the vector has been
+       * initialized with a shared-memory communicator. It sets up the
+       * communication pattern, which is shared with all vectors initialized
+       * from this one by reinit(const Vector &, bool). Calls to the other
+       * reinit() functions return the vector to the default exchange. The
+       * shared-memory exchange is only available for vectors stored on the
+       * host; the function does nothing for other vectors or if none of the
+       * shared-memory communicators contains more than one process.
+       */
+      void
+      enable_shared_memory_ghost_exchange();
+
+      /**
+       * Fill the data field for ghost indices with the values stored in the
+       * respective positions of the owning processor, like
+       * update_ghost_values(), and overlap the communication with
+       * computations on the locally owned part of the vector.
+       *
+       * The function first starts the ghost exchange as in
+       * update_ghost_values_start(). While the messages are in flight, it
+       * calls @p interior_work for each range of local indices of
+       * Utilities::MPI::Partitioner::locally_owned_interior_ranges(), i.e.,
+       * for the locally owned indices that are not ghosts on any other
+       * processor. After the exchange has finished, @p boundary_work is
+       * called for each range of
+       * Utilities::MPI::Partitioner::locally_owned_boundary_ranges(). Both
+       * functions receive the half-open range <code>[begin, end)</code> of
+       * local indices in the numbering of local_element().
+       *
+       * This allows to implement a matrix-vector product that computes the
+       * rows that do not depend on ghost values while the ghost values are
+       * communicated, see SparseMatrix::vmult_overlapped() for an example.
+       * This assumes that the ghost indices of all processors have been set
+       * up from the couplings of a symmetric operator, such as the locally
+       * relevant degrees of freedom in a finite element discretization: In
+       * that case, a locally owned row that couples to a ghost index is a
+       * ghost index on the processor owning that index, and is hence part of
+       * the boundary ranges.
+       *
+       * If the vector already is in ghosted state, no communication is done
+       * and both functions are called right away.
+       */
+      void
+      update_ghost_values_overlapped(
+        const std::function<void(const unsigned int, const unsigned int)>
+          &interior_work,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &boundary_work) const;
+
       /**
        * This method zeros the entries on ghost dofs, but does not touch
        * locally owned DoFs.
@@ -1418,6 +1503,13 @@ namespace LinearAlgebra
        * operations. This class uses persistent MPI communicators.
        */
       mutable std::vector<MPI_Request> update_ghost_values_requests;
+
+      /**
+       * A vector that collects the requests signaling to the shared-memory
+       * neighbors that data is ready to be read or has been read, if
+       * enable_shared_memory_ghost_exchange() has been called.
+       */
+      mutable std::vector<MPI_Request> shared_memory_requests;
 #endif
 
       /**
@@ -1435,8 +1527,18 @@ namespace LinearAlgebra
       MPI_Comm comm_sm;
 
       /**
-       * A helper function that clears the compress_requests and
-       * update_ghost_values_requests field. Used in reinit() functions.
+       * The communication pattern for exchanging data through the shared
+       * memory, set up by enable_shared_memory_ghost_exchange(). If empty,
+       * the exchange goes through the partitioner.
+       */
+      std::shared_ptr<const ::dealii::internal::LinearAlgebraDistributedVector::
+                        SharedMemoryGhostExchange>
+        shared_memory_exchange;
+
+      /**
+       * A helper function that clears the compress_requests,
+       * update_ghost_values_requests, and shared_memory_requests fields. Used
+       * in reinit() functions.
        */
       void
       clear_mpi_requests();
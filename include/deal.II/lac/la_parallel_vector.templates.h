@@ -22,6 +22,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_vector.h>
 #include <deal.II/lac/read_write_vector.h>
+#include <deal.II/lac/shared_memory_ghost_exchange.h>
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
@@ -564,6 +565,13 @@ namespace LinearAlgebra
           AssertThrowMPI(ierr);
         }
       update_ghost_values_requests.clear();
+      for (auto &shared_memory_request : shared_memory_requests)
+        if (shared_memory_request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Request_free(&shared_memory_request);
+            AssertThrowMPI(ierr);
+          }
+      shared_memory_requests.clear();
 #endif
     }
 
@@ -593,6 +601,7 @@ namespace LinearAlgebra
                                             const bool omit_zeroing_entries)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       // check whether we need to reallocate
       resize_val(size, comm_sm);
@@ -622,6 +631,7 @@ namespace LinearAlgebra
       const MPI_Comm                comm_sm)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       this->comm_sm = comm_sm;
 
@@ -652,7 +662,8 @@ namespace LinearAlgebra
       clear_mpi_requests();
       Assert(v.partitioner.get() != nullptr, ExcNotInitialized());
 
-      this->comm_sm = v.comm_sm;
+      this->comm_sm                = v.comm_sm;
+      this->shared_memory_exchange = v.shared_memory_exchange;
 
       // check whether the partitioners are
       // different (check only if the are allocated
@@ -718,6 +729,7 @@ namespace LinearAlgebra
       const MPI_Comm                                            comm_sm)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       this->comm_sm = comm_sm;
 
@@ -996,6 +1008,53 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::enable_shared_memory_ghost_exchange()
+    {
+#ifdef DEAL_II_WITH_MPI
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host>)
+        {
+          // all processes need to take the same decision, as setting up the
+          // exchange is collective over the communicator of the partitioner
+          if (Utilities::MPI::max(Utilities::MPI::n_mpi_processes(comm_sm),
+                                  partitioner->get_mpi_communicator()) > 1)
+            {
+              clear_mpi_requests();
+              shared_memory_exchange = std::make_shared<
+                ::dealii::internal::LinearAlgebraDistributedVector::
+                  SharedMemoryGhostExchange>(partitioner, comm_sm);
+            }
+        }
+#endif
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::update_ghost_values_overlapped(
+      const std::function<void(const unsigned int, const unsigned int)>
+        &interior_work,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &boundary_work) const
+    {
+      const bool needs_exchange = !vector_is_ghosted;
+      if (needs_exchange)
+        update_ghost_values_start();
+
+      for (const auto &range : partitioner->locally_owned_interior_ranges())
+        interior_work(range.first, range.second);
+
+      if (needs_exchange)
+        update_ghost_values_finish();
+
+      for (const auto &range : partitioner->locally_owned_boundary_ranges())
+        boundary_work(range.first, range.second);
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::zero_out_ghost_values() const
@@ -1066,6 +1125,26 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host>)
+        if (shared_memory_exchange != nullptr &&
+            operation == VectorOperation::add)
+          {
+            const unsigned int buffer_size =
+              shared_memory_exchange->buffer_size();
+            if (import_data.values.size() < buffer_size)
+              Kokkos::resize(import_data.values, buffer_size);
+
+            shared_memory_exchange->import_from_ghosted_array_start(
+              communication_channel,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(), buffer_size),
+              compress_requests,
+              shared_memory_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, dealii::MemorySpace::Default>)
         {
@@ -1128,6 +1207,24 @@ namespace LinearAlgebra
 
       // make this function thread safe
       std::lock_guard<std::mutex> lock(mutex);
+
+      // the ghost entries are zeroed during the exchange, by the owning
+      // process for the ones owned within the shared-memory domain
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host>)
+        if (shared_memory_exchange != nullptr &&
+            operation == VectorOperation::add)
+          {
+            shared_memory_exchange->import_from_ghosted_array_finish(
+              ArrayView<Number>(data.values.data(),
+                                partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(import_data.values.data(),
+                                shared_memory_exchange->buffer_size()),
+              compress_requests,
+              shared_memory_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1226,6 +1323,24 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host>)
+        if (shared_memory_exchange != nullptr)
+          {
+            const unsigned int buffer_size =
+              shared_memory_exchange->buffer_size();
+            if (import_data.values.size() < buffer_size)
+              Kokkos::resize(import_data.values, buffer_size);
+
+            shared_memory_exchange->export_to_ghosted_array_start(
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              ArrayView<Number>(import_data.values.data(), buffer_size),
+              update_ghost_values_requests,
+              shared_memory_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1283,6 +1398,27 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::update_ghost_values_finish() const
     {
 #ifdef DEAL_II_WITH_MPI
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host>)
+        if (shared_memory_exchange != nullptr)
+          {
+            if (update_ghost_values_requests.size() > 0 ||
+                shared_memory_requests.size() > 0)
+              {
+                std::lock_guard<std::mutex> lock(mutex);
+                shared_memory_exchange->export_to_ghosted_array_finish(
+                  data.values_sm,
+                  ArrayView<Number>(data.values.data() +
+                                      partitioner->locally_owned_size(),
+                                    partitioner->n_ghost_indices()),
+                  ArrayView<Number>(import_data.values.data(),
+                                    shared_memory_exchange->buffer_size()),
+                  update_ghost_values_requests,
+                  shared_memory_requests);
+              }
+            vector_is_ghosted = true;
+            return;
+          }
+
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
       AssertDimension(partitioner->ghost_targets().size() +
@@ -1460,7 +1596,9 @@ namespace LinearAlgebra
 
       std::swap(compress_requests, v.compress_requests);
       std::swap(update_ghost_values_requests, v.update_ghost_values_requests);
+      std::swap(shared_memory_requests, v.shared_memory_requests);
       std::swap(comm_sm, v.comm_sm);
+      std::swap(shared_memory_exchange, v.shared_memory_exchange);
 #endif
 
       std::swap(partitioner, v.partitioner);
@@ -0,0 +1,342 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#ifndef dealii_precondition_mixed_precision_h
+#define dealii_precondition_mixed_precision_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * A preconditioner that approximately solves a linear system in lower
+ * precision. The vmult() function converts the vector it is given to the
+ * vector type of the inner solver (by default Vector<float>), runs the inner
+ * solver with a matrix and preconditioner stored in that precision until the
+ * residual has been reduced by a given factor or the maximal number of inner
+ * iterations is reached, and converts the result back.
+ *
+ * This class implements the inner part of a mixed-precision iterative
+ * refinement scheme: most of the work is done with a matrix whose entries are
+ * stored in single precision, halving the memory traffic of the
+ * matrix-vector products that dominate the run time of sparse solvers, while
+ * an outer solver in double precision ensures that the final residual reaches
+ * the accuracy of double precision. Classical iterative refinement is obtained
+ * by using this class as the preconditioner of SolverRichardson. Since the
+ * inner solves are inexact, the preconditioner is not a fixed linear operator,
+ * and Krylov methods should be of the flexible kind, such as SolverFGMRES or
+ * SolverFlexibleCG:
+ * @code
+ * SparseMatrix<double> system_matrix;
+ * ... // assemble system_matrix
+ *
+ * SparseMatrix<float> system_matrix_float(sparsity_pattern);
+ * system_matrix_float.copy_from(system_matrix);
+ *
+ * PreconditionJacobi<SparseMatrix<float>> inner_preconditioner;
+ * inner_preconditioner.initialize(system_matrix_float);
+ *
+ * PreconditionMixedPrecision<SparseMatrix<float>,
+ *                            PreconditionJacobi<SparseMatrix<float>>>
+ *   preconditioner;
+ * preconditioner.initialize(system_matrix_float, inner_preconditioner);
+ *
+ * SolverControl                      solver_control(100, 1e-12);
+ * SolverFlexibleCG<Vector<double>>   solver(solver_control);
+ * solver.solve(system_matrix, solution, system_rhs, preconditioner);
+ * @endcode
+ *
+ * The inner matrix can be any matrix type that provides a vmult() function
+ * for the vector type of the inner solver, like a SparseMatrix<float> or a
+ * matrix-free operator evaluated in single precision. Note that SparseMatrix
+ * also offers the matrix-vector product of a SparseMatrix<float> with vectors
+ * of type Vector<double> and LinearAlgebra::distributed::Vector<double>,
+ * which allows to apply the outer operator from single-precision storage as
+ * well, if its accuracy is sufficient for the problem at hand.
+ *
+ * Since the right hand side of the inner solves is the residual of the outer
+ * solver, which can become small in the course of the outer iteration, the
+ * inner solver works with relative tolerances only. The representable range
+ * of single precision numbers is sufficient as long as the outer residual
+ * does not drop below approximately $10^{-30}$ times the magnitude of the
+ * entries of the matrix.
+ *
+ * @tparam MatrixType The type of the inner matrix.
+ * @tparam PreconditionerType The type of the preconditioner of the inner
+ * solver.
+ * @tparam InnerSolverType The type of the inner solver, whose vector type
+ * determines the precision of the inner solve.
+ */
+template <typename MatrixType,
+          typename PreconditionerType = PreconditionIdentity,
+          typename InnerSolverType    = SolverCG<Vector<float>>>
+class PreconditionMixedPrecision : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * The vector type used by the inner solver.
+   */
+  using InnerVectorType = typename InnerSolverType::vector_type;
+
+  /**
+   * Parameters of the inner solve.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int max_inner_iterations = 100,
+                   const double       inner_reduction      = 1e-3);
+
+    /**
+     * Maximal number of iterations of the inner solver per call to vmult().
+     * Reaching this number is not an error, the current approximation is
+     * returned.
+     */
+    unsigned int max_inner_iterations;
+
+    /**
+     * Factor by which the inner solver reduces the residual of the vector
+     * passed to vmult(). Values much smaller than the machine accuracy of
+     * the inner number type are not useful.
+     */
+    double inner_reduction;
+  };
+
+  /**
+   * Constructor.
+   */
+  PreconditionMixedPrecision();
+
+  /**
+   * Store the inner matrix and preconditioner along with the parameters of
+   * the inner solve. Both objects must persist as long as this object is
+   * used.
+   */
+  void
+  initialize(const MatrixType         &matrix,
+             const PreconditionerType &preconditioner,
+             const AdditionalData     &additional_data = AdditionalData());
+
+  /**
+   * Release the pointers to the inner matrix and preconditioner.
+   */
+  void
+  clear();
+
+  /**
+   * Approximately solve the inner system with right hand side @p src in the
+   * precision of the inner solver and write the result to @p dst.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose preconditioner. Since the inner solver only supports
+   * solving with the matrix itself, this function is the same as vmult()
+   * and should only be used with symmetric inner matrices.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the number of iterations the inner solver took in the last call
+   * to vmult().
+   */
+  unsigned int
+  last_n_inner_iterations() const;
+
+private:
+  /**
+   * Pointer to the inner matrix.
+   */
+  ObserverPointer<const MatrixType, PreconditionMixedPrecision> matrix;
+
+  /**
+   * Pointer to the preconditioner of the inner solver.
+   */
+  ObserverPointer<const PreconditionerType, PreconditionMixedPrecision>
+    preconditioner;
+
+  /**
+   * Parameters of the inner solve.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * Right hand side of the inner solve, in inner precision.
+   */
+  mutable InnerVectorType inner_src;
+
+  /**
+   * Solution of the inner solve, in inner precision.
+   */
+  mutable InnerVectorType inner_dst;
+
+  /**
+   * Number of iterations of the last inner solve.
+   */
+  mutable unsigned int n_inner_iterations;
+};
+
+/** @} */
+
+//---------------------------------------------------------------------------
+#ifndef DOXYGEN
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+inline PreconditionMixedPrecision<MatrixType,
+                                  PreconditionerType,
+                                  InnerSolverType>::AdditionalData::
+  AdditionalData(const unsigned int max_inner_iterations,
+                 const double       inner_reduction)
+  : max_inner_iterations(max_inner_iterations)
+  , inner_reduction(inner_reduction)
+{}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+inline PreconditionMixedPrecision<MatrixType,
+                                  PreconditionerType,
+                                  InnerSolverType>::PreconditionMixedPrecision()
+  : n_inner_iterations(0)
+{}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+inline void
+PreconditionMixedPrecision<MatrixType, PreconditionerType, InnerSolverType>::
+  initialize(const MatrixType         &matrix,
+             const PreconditionerType &preconditioner,
+             const AdditionalData     &additional_data)
+{
+  Assert(additional_data.inner_reduction > 0. &&
+           additional_data.inner_reduction < 1.,
+         ExcMessage("The reduction factor of the inner solver must be "
+                    "between zero and one."));
+  this->matrix          = &matrix;
+  this->preconditioner  = &preconditioner;
+  this->additional_data = additional_data;
+}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+inline void
+PreconditionMixedPrecision<MatrixType, PreconditionerType, InnerSolverType>::
+  clear()
+{
+  matrix         = nullptr;
+  preconditioner = nullptr;
+  inner_src.reinit(0);
+  inner_dst.reinit(0);
+}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+template <typename VectorType>
+inline void
+PreconditionMixedPrecision<MatrixType, PreconditionerType, InnerSolverType>::
+  vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+
+  inner_src = src;
+  inner_dst.reinit(inner_src);
+
+  // the absolute tolerance is zero, such that the inner solver only stops
+  // upon the relative reduction or the maximal number of iterations
+  ReductionControl control(additional_data.max_inner_iterations,
+                           0.,
+                           additional_data.inner_reduction,
+                           false,
+                           false);
+  InnerSolverType  solver(control);
+  try
+    {
+      solver.solve(*matrix, inner_dst, inner_src, *preconditioner);
+    }
+  catch (const SolverControl::NoConvergence &)
+    {
+      // an inexact inner solve is fine, the outer solver corrects for it
+    }
+  n_inner_iterations = control.last_step();
+
+  dst = inner_dst;
+}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+template <typename VectorType>
+inline void
+PreconditionMixedPrecision<MatrixType, PreconditionerType, InnerSolverType>::
+  Tvmult(VectorType &dst, const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <typename MatrixType,
+          typename PreconditionerType,
+          typename InnerSolverType>
+inline unsigned int
+PreconditionMixedPrecision<MatrixType, PreconditionerType, InnerSolverType>::
+  last_n_inner_iterations() const
+{
+  return n_inner_iterations;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,426 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#ifndef dealii_lac_shared_memory_ghost_exchange_h
+#define dealii_lac_shared_memory_ghost_exchange_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_tags.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/vector_operation.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+#ifdef DEAL_II_WITH_MPI
+
+namespace internal
+{
+  namespace LinearAlgebraDistributedVector
+  {
+    /**
+     * The communication pattern set up by the function
+     * enable_shared_memory_ghost_exchange() of
+     * LinearAlgebra::distributed::Vector.
+     *
+     * Ghost values owned by a process of the same shared-memory communicator
+     * are copied directly out of the MPI-3 shared-memory window of the owner,
+     * and the owner adds the ghost contributions of such processes directly
+     * out of their windows during compress(). The data of all other
+     * processes is exchanged by a Utilities::MPI::Partitioner restricted to
+     * them, which works on a separate buffer for these ghost values.
+     *
+     * A process only synchronizes with the processes it reads data from or
+     * that read its data. It signals by an empty message that its data is
+     * ready to be read, and the reader answers by another empty message once
+     * it is done, after which the data may be modified again.
+     */
+    class SharedMemoryGhostExchange
+    {
+    public:
+      /**
+       * Set up the communication pattern for the ghost indices of
+       * @p partitioner within the shared-memory communicator @p comm_sm.
+       * This is a collective operation on the communicator of
+       * @p partitioner.
+       */
+      SharedMemoryGhostExchange(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const MPI_Comm                                            comm_sm);
+
+      /**
+       * Return the size of the buffer the functions below expect, holding
+       * the import data of the processes outside the shared-memory domain
+       * followed by the ghost values owned by them.
+       */
+      unsigned int
+      buffer_size() const;
+
+      /**
+       * Start update_ghost_values(): send the locally owned values needed by
+       * processes outside the shared-memory domain and signal to the
+       * shared-memory neighbors that they may read the locally owned values.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_start(
+        const unsigned int             communication_channel,
+        const ArrayView<const Number> &locally_owned_array,
+        const ArrayView<Number>       &buffer,
+        std::vector<MPI_Request>      &requests,
+        std::vector<MPI_Request>      &sm_requests) const;
+
+      /**
+       * Finish update_ghost_values(): copy the ghost values out of the
+       * windows @p data_sm of the owners as soon as they are ready, copy the
+       * values received from other nodes into @p ghost_array, and wait until
+       * all shared-memory neighbors have read the locally owned values.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_finish(
+        const std::vector<ArrayView<const Number>> &data_sm,
+        const ArrayView<Number>                    &ghost_array,
+        const ArrayView<Number>                    &buffer,
+        std::vector<MPI_Request>                   &requests,
+        std::vector<MPI_Request>                   &sm_requests) const;
+
+      /**
+       * Start compress(VectorOperation::add): send the ghost values owned by
+       * processes outside the shared-memory domain and signal to the owners
+       * in the shared-memory domain that they may read the other ghost
+       * values.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_start(
+        const unsigned int        communication_channel,
+        const ArrayView<Number>  &ghost_array,
+        const ArrayView<Number>  &buffer,
+        std::vector<MPI_Request> &requests,
+        std::vector<MPI_Request> &sm_requests) const;
+
+      /**
+       * Finish compress(VectorOperation::add): add the ghost values of the
+       * shared-memory neighbors out of their windows @p data_sm to
+       * @p locally_owned_array as soon as they are ready and zero them, add
+       * the values received from other nodes, and wait until the owners have
+       * processed the ghost values of this process.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_finish(
+        const ArrayView<Number>                    &locally_owned_array,
+        const std::vector<ArrayView<const Number>> &data_sm,
+        const ArrayView<Number>                    &buffer,
+        std::vector<MPI_Request>                   &requests,
+        std::vector<MPI_Request>                   &sm_requests) const;
+
+    private:
+      /**
+       * Post the signals of an exchange with tag @p tag: the ready signals
+       * to the processes in @p readers, which read data of this process,
+       * and from the processes in @p read_from, whose data this process
+       * reads, as well as the done signals from the processes in
+       * @p readers. The done signals to the processes in @p read_from are
+       * set up as persistent requests and sent by signal_done().
+       */
+      void
+      start_signals(const std::vector<unsigned int> &readers,
+                    const std::vector<unsigned int> &read_from,
+                    const int                        tag,
+                    std::vector<MPI_Request>        &sm_requests) const;
+
+      /**
+       * Send the done signal to the <tt>i</tt>th process this process reads
+       * data from, given the number @p n_readers of processes reading data
+       * of this process.
+       */
+      void
+      signal_done(const unsigned int        i,
+                  const unsigned int        n_readers,
+                  std::vector<MPI_Request> &sm_requests) const;
+
+      /**
+       * Wait for all signals to be sent and received, and free the requests.
+       */
+      void
+      finish_signals(std::vector<MPI_Request> &sm_requests) const;
+
+      /**
+       * Shared-memory communicator.
+       */
+      MPI_Comm comm_sm;
+
+      /**
+       * Partitioner for the exchange with processes outside the
+       * shared-memory domain.
+       */
+      std::shared_ptr<const Utilities::MPI::Partitioner> remote_partitioner;
+
+      /**
+       * Ranges (first position in the ghost array, number of entries) of the
+       * ghost values owned by processes outside the shared-memory domain.
+       */
+      std::vector<std::pair<unsigned int, unsigned int>> remote_ghost_ranges;
+
+      /**
+       * Ranks within @p comm_sm of the owners of ghost values.
+       */
+      std::vector<unsigned int> ghost_ranks_sm;
+
+      /**
+       * Position of the first ghost value owned by each of the processes in
+       * ghost_ranks_sm within the ghost array.
+       */
+      std::vector<unsigned int> ghost_offsets_sm;
+
+      /**
+       * Offsets into ghost_indices_sm for each of the processes in
+       * ghost_ranks_sm.
+       */
+      std::vector<unsigned int> ghost_ptr_sm;
+
+      /**
+       * Indices of the ghost values within the locally owned range of their
+       * owner.
+       */
+      std::vector<unsigned int> ghost_indices_sm;
+
+      /**
+       * Ranks within @p comm_sm of the processes holding locally owned
+       * entries as ghost values.
+       */
+      std::vector<unsigned int> import_ranks_sm;
+
+      /**
+       * Position of the ghost values of each of the processes in
+       * import_ranks_sm that are owned by this process within the data of
+       * that process, i.e., relative to the start of its locally owned
+       * values.
+       */
+      std::vector<unsigned int> import_offsets_sm;
+
+      /**
+       * Offsets into import_indices_sm for each of the processes in
+       * import_ranks_sm.
+       */
+      std::vector<unsigned int> import_ptr_sm;
+
+      /**
+       * Locally owned indices corresponding to the ghost values of the
+       * processes in import_ranks_sm.
+       */
+      std::vector<unsigned int> import_indices_sm;
+    };
+
+
+
+    /* ------------------------ inline functions ---------------------------- */
+
+#  ifndef DOXYGEN
+
+    template <typename Number>
+    void
+    SharedMemoryGhostExchange::export_to_ghosted_array_start(
+      const unsigned int             communication_channel,
+      const ArrayView<const Number> &locally_owned_array,
+      const ArrayView<Number>       &buffer,
+      std::vector<MPI_Request>      &requests,
+      std::vector<MPI_Request>      &sm_requests) const
+    {
+      AssertIndexRange(communication_channel, 200);
+      AssertDimension(buffer.size(), buffer_size());
+
+      remote_partitioner->export_to_ghosted_array_start(
+        communication_channel,
+        locally_owned_array,
+        ArrayView<Number>(buffer.data(),
+                          remote_partitioner->n_import_indices()),
+        ArrayView<Number>(buffer.data() +
+                            remote_partitioner->n_import_indices(),
+                          remote_partitioner->n_ghost_indices()),
+        requests);
+
+      start_signals(
+        import_ranks_sm,
+        ghost_ranks_sm,
+        Utilities::MPI::internal::Tags::shared_memory_ghost_export_start +
+          communication_channel,
+        sm_requests);
+    }
+
+
+
+    template <typename Number>
+    void
+    SharedMemoryGhostExchange::export_to_ghosted_array_finish(
+      const std::vector<ArrayView<const Number>> &data_sm,
+      const ArrayView<Number>                    &ghost_array,
+      const ArrayView<Number>                    &buffer,
+      std::vector<MPI_Request>                   &requests,
+      std::vector<MPI_Request>                   &sm_requests) const
+    {
+      AssertDimension(buffer.size(), buffer_size());
+      AssertDimension(sm_requests.size(),
+                      2 * (import_ranks_sm.size() + ghost_ranks_sm.size()));
+
+      // copy the ghost values out of the memory of the owners in the order
+      // the owners get ready
+      for (unsigned int c = 0; c < ghost_ranks_sm.size(); ++c)
+        {
+          int       i;
+          const int ierr =
+            MPI_Waitany(ghost_ranks_sm.size(),
+                        sm_requests.data() + import_ranks_sm.size(),
+                        &i,
+                        MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+
+          const Number *owner_data = data_sm[ghost_ranks_sm[i]].data();
+          Number       *ghost_data = ghost_array.data() + ghost_offsets_sm[i];
+          for (unsigned int j = ghost_ptr_sm[i], k = 0; j < ghost_ptr_sm[i + 1];
+               ++j, ++k)
+            ghost_data[k] = owner_data[ghost_indices_sm[j]];
+
+          signal_done(i, import_ranks_sm.size(), sm_requests);
+        }
+
+      const ArrayView<Number> remote_ghosts(
+        buffer.data() + remote_partitioner->n_import_indices(),
+        remote_partitioner->n_ghost_indices());
+      remote_partitioner->export_to_ghosted_array_finish(remote_ghosts,
+                                                         requests);
+      for (unsigned int r = 0, k = 0; r < remote_ghost_ranges.size(); ++r)
+        for (unsigned int i = 0; i < remote_ghost_ranges[r].second; ++i, ++k)
+          ghost_array[remote_ghost_ranges[r].first + i] = remote_ghosts[k];
+
+      // the locally owned values must not be modified before the readers
+      // are done
+      finish_signals(sm_requests);
+    }
+
+
+
+    template <typename Number>
+    void
+    SharedMemoryGhostExchange::import_from_ghosted_array_start(
+      const unsigned int        communication_channel,
+      const ArrayView<Number>  &ghost_array,
+      const ArrayView<Number>  &buffer,
+      std::vector<MPI_Request> &requests,
+      std::vector<MPI_Request> &sm_requests) const
+    {
+      AssertIndexRange(communication_channel, 200);
+      AssertDimension(buffer.size(), buffer_size());
+
+      // move the ghost values owned by remote processes into the buffer
+      const ArrayView<Number> remote_ghosts(
+        buffer.data() + remote_partitioner->n_import_indices(),
+        remote_partitioner->n_ghost_indices());
+      for (unsigned int r = 0, k = 0; r < remote_ghost_ranges.size(); ++r)
+        for (unsigned int i = 0; i < remote_ghost_ranges[r].second; ++i, ++k)
+          {
+            Number &ghost    = ghost_array[remote_ghost_ranges[r].first + i];
+            remote_ghosts[k] = ghost;
+            ghost            = Number();
+          }
+
+      remote_partitioner->import_from_ghosted_array_start(
+        VectorOperation::add,
+        communication_channel,
+        remote_ghosts,
+        ArrayView<Number>(buffer.data(),
+                          remote_partitioner->n_import_indices()),
+        requests);
+
+      start_signals(
+        ghost_ranks_sm,
+        import_ranks_sm,
+        Utilities::MPI::internal::Tags::shared_memory_ghost_import_start +
+          communication_channel,
+        sm_requests);
+    }
+
+
+
+    template <typename Number>
+    void
+    SharedMemoryGhostExchange::import_from_ghosted_array_finish(
+      const ArrayView<Number>                    &locally_owned_array,
+      const std::vector<ArrayView<const Number>> &data_sm,
+      const ArrayView<Number>                    &buffer,
+      std::vector<MPI_Request>                   &requests,
+      std::vector<MPI_Request>                   &sm_requests) const
+    {
+      AssertDimension(buffer.size(), buffer_size());
+      AssertDimension(sm_requests.size(),
+                      2 * (import_ranks_sm.size() + ghost_ranks_sm.size()));
+
+      // add the ghost values out of the memory of the other processes in the
+      // order they get ready, and zero them as compress() does for the ghost
+      // values of this process
+      for (unsigned int c = 0; c < import_ranks_sm.size(); ++c)
+        {
+          int       i;
+          const int ierr =
+            MPI_Waitany(import_ranks_sm.size(),
+                        sm_requests.data() + ghost_ranks_sm.size(),
+                        &i,
+                        MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+
+          Number *ghost_data =
+            const_cast<Number *>(data_sm[import_ranks_sm[i]].data()) +
+            import_offsets_sm[i];
+          for (unsigned int j = import_ptr_sm[i], k = 0;
+               j < import_ptr_sm[i + 1];
+               ++j, ++k)
+            {
+              locally_owned_array[import_indices_sm[j]] += ghost_data[k];
+              ghost_data[k] = Number();
+            }
+
+          signal_done(i, ghost_ranks_sm.size(), sm_requests);
+        }
+
+      remote_partitioner->import_from_ghosted_array_finish(
+        VectorOperation::add,
+        ArrayView<const Number>(buffer.data(),
+                                remote_partitioner->n_import_indices()),
+        locally_owned_array,
+        ArrayView<Number>(buffer.data() +
+                            remote_partitioner->n_import_indices(),
+                          remote_partitioner->n_ghost_indices()),
+        requests);
+
+      // the ghost values must not be modified before the owners are done
+      finish_signals(sm_requests);
+    }
+
+#  endif // DOXYGEN
+
+  } // namespace LinearAlgebraDistributedVector
+} // namespace internal
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
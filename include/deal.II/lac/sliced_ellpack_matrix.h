@@ -0,0 +1,927 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#ifndef dealii_sliced_ellpack_matrix_h
+#define dealii_sliced_ellpack_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the SELL-C-$\sigma$ (sliced ELLPACK) format. The
+ * rows of the matrix are grouped into chunks of $C$ consecutive rows, where
+ * $C$ is the number of lanes of VectorizedArray<Number>, i.e., the SIMD width
+ * of the machine for the given number type. Within each chunk, all rows are
+ * padded with zeros to the length of the longest row of the chunk and the
+ * entries are stored column by column, i.e., the $j$-th entries of the $C$
+ * rows of a chunk are contiguous in memory. This allows the matrix-vector
+ * product to process the rows of a chunk simultaneously in the SIMD lanes,
+ * using a contiguous load for the matrix entries and a gather operation for
+ * the entries of the source vector, rather than the per-row reduction of the
+ * compressed row storage used by SparseMatrix, whose inner loop is latency
+ * bound for the short rows typical of finite element matrices.
+ *
+ * To limit the amount of padding when rows of different length are mixed,
+ * the rows can be sorted by decreasing length within windows of $\sigma$
+ * consecutive rows before the chunks are formed. The default $\sigma=1$
+ * keeps the original row order, which is appropriate for matrices from
+ * (continuous) finite elements where neighboring rows usually have similar
+ * length. The sorting only affects the internal storage; the interface of
+ * this class always uses the original row numbering.
+ *
+ * The matrix is set up from a SparsityPattern (see reinit()) and then filled
+ * with the entries of a SparseMatrix built on the same pattern (see
+ * copy_from()). It is meant as a read-only representation for the fast
+ * application of an already assembled matrix, e.g., inside an iterative
+ * solver, and does thus not offer element-wise modification.
+ *
+ * Column indices are stored as <tt>unsigned int</tt>, which is the index type
+ * accepted by VectorizedArray::gather(). The number of columns is therefore
+ * limited to $2^{32}-1$ also when deal.II is configured with 64-bit indices.
+ * Furthermore, the column indices of a chunk are by default stored as 16-bit
+ * offsets relative to the smallest column index of the chunk whenever the
+ * columns of the chunk span fewer than $2^{16}$ indices. For matrices with a
+ * small bandwidth, as obtained for finite element discretizations after
+ * renumbering the unknowns with DoFRenumbering::Cuthill_McKee(), this applies
+ * to most chunks and halves the memory and bandwidth needed for the indices,
+ * which reduces the total amount of data read by vmult() by roughly a sixth
+ * for double and a quarter for float entries.
+ *
+ * @tparam Number The number type of the matrix entries, which is also the
+ * number type of the vectors this matrix can be multiplied with.
+ */
+template <typename Number>
+class SlicedEllpackMatrix : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = Number;
+
+  /**
+   * The number of rows grouped into one chunk, given by the number of lanes
+   * of VectorizedArray<Number>.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<Number>::size();
+
+  /**
+   * Default constructor. Creates an empty object.
+   */
+  SlicedEllpackMatrix();
+
+  /**
+   * Constructor setting up the storage from the sparsity pattern of @p matrix
+   * and copying its entries. Equivalent to calling reinit() with the sparsity
+   * pattern of the matrix followed by copy_from().
+   */
+  template <typename Number2>
+  explicit SlicedEllpackMatrix(const SparseMatrix<Number2> &matrix,
+                               const unsigned int           sigma = 1,
+                               const bool compress_column_indices = true);
+
+  /**
+   * Set up the chunked storage for the given sparsity pattern and set all
+   * entries to zero. Within windows of @p sigma rows, the rows are sorted by
+   * decreasing length before they are grouped into chunks; a value of one
+   * disables sorting. If @p compress_column_indices is set, the column
+   * indices of the chunks whose columns span fewer than $2^{16}$ indices are
+   * stored as 16-bit offsets, see the general documentation of this class.
+   */
+  void
+  reinit(const SparsityPattern &sparsity,
+         const unsigned int     sigma                   = 1,
+         const bool             compress_column_indices = true);
+
+  /**
+   * Set up the storage for the sparsity pattern of @p matrix and copy its
+   * entries.
+   */
+  template <typename Number2>
+  void
+  reinit(const SparseMatrix<Number2> &matrix,
+         const unsigned int           sigma                   = 1,
+         const bool                   compress_column_indices = true);
+
+  /**
+   * Copy the entries of @p matrix into this object. The matrix must be based
+   * on the same sparsity pattern (or one with identical structure) as the
+   * one passed to reinit().
+   */
+  template <typename Number2>
+  void
+  copy_from(const SparseMatrix<Number2> &matrix);
+
+  /**
+   * Release all memory and return to a state just like after calling the
+   * default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return whether the object is empty, i.e., whether either of its
+   * dimensions is zero.
+   */
+  bool
+  empty() const;
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero entries of the underlying sparsity pattern.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of stored entries, including the zeros used to pad the
+   * rows of a chunk to the same length. The ratio between this number and
+   * n_nonzero_elements() measures the storage overhead of the format.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Return the sorting scope $\sigma$ the storage was built with.
+   */
+  unsigned int
+  get_sigma() const;
+
+  /**
+   * Return the number of chunks whose column indices are stored as 16-bit
+   * offsets.
+   */
+  unsigned int
+  n_chunks_with_compressed_indices() const;
+
+  /**
+   * Return the diagonal entry in row @p i. The matrix must be quadratic.
+   */
+  Number
+  diag_element(const size_type i) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   *
+   * The vector type must store its elements contiguously and provide
+   * pointer access through <tt>begin()</tt>, as is the case for
+   * Vector<Number> and serial LinearAlgebra::distributed::Vector<Number>.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: let $dst += M*src$.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication with the transpose matrix: let $dst =
+   * M^T*src$. This operation needs to scatter into the destination vector
+   * and is not vectorized.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding transpose matrix-vector multiplication: let $dst += M^T*src$.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the Jacobi preconditioner, which multiplies every element of the
+   * @p src vector by the inverse of the respective diagonal element and
+   * multiplies the result with the relaxation factor @p omega.
+   */
+  template <typename VectorType>
+  void
+  precondition_Jacobi(VectorType       &dst,
+                      const VectorType &src,
+                      const Number      omega = 1.) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcTooManyColumns,
+                   "The SlicedEllpackMatrix class stores column indices as "
+                   "unsigned int and can therefore not represent matrices "
+                   "with 2^32 or more columns.");
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+
+private:
+  /**
+   * Perform the product of the rows in chunks <tt>[begin_chunk,
+   * end_chunk)</tt> with @p src, writing or (if @p add is set) adding the
+   * result into the respective rows of @p dst.
+   */
+  void
+  vmult_on_subrange(const unsigned int begin_chunk,
+                    const unsigned int end_chunk,
+                    const Number      *src,
+                    Number            *dst,
+                    const bool         add) const;
+
+  /**
+   * Return the column index of the entry with index @p index within chunk
+   * @p chunk, where the entries of a chunk are counted in the interleaved
+   * storage order.
+   */
+  unsigned int
+  get_column(const size_type chunk, const std::size_t index) const;
+
+  /**
+   * Number of rows.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of nonzero entries of the sparsity pattern the object was set up
+   * with.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * Sorting scope.
+   */
+  unsigned int sigma;
+
+  /**
+   * Whether the rows have been reordered by the sorting step. If not, the
+   * rows of chunk $c$ are the rows <tt>c*chunk_size</tt> to
+   * <tt>(c+1)*chunk_size-1</tt>, which allows to write the result of the
+   * matrix-vector product with a contiguous store.
+   */
+  bool rows_are_permuted;
+
+  /**
+   * For each lane of each chunk, the index of the row in the original
+   * numbering, or numbers::invalid_size_type for the lanes of the last chunk
+   * that are not filled.
+   */
+  std::vector<size_type> row_indices;
+
+  /**
+   * For each lane of each chunk, the number of nonzero entries in the
+   * respective row.
+   */
+  std::vector<unsigned int> row_lengths;
+
+  /**
+   * Offset of each chunk in the array #values. The length of chunk $c$ is
+   * <tt>(chunk_starts[c+1]-chunk_starts[c]) / chunk_size</tt>.
+   */
+  std::vector<std::size_t> chunk_starts;
+
+  /**
+   * For each chunk, the smallest column index of the chunk if the column
+   * indices are stored as offsets in #column_offsets, or
+   * numbers::invalid_unsigned_int if they are stored in #column_indices.
+   */
+  std::vector<unsigned int> column_bases;
+
+  /**
+   * Offset of each chunk in the array #column_offsets or #column_indices,
+   * depending on #column_bases.
+   */
+  std::vector<std::size_t> column_starts;
+
+  /**
+   * Full column indices of the stored entries of the chunks that are not
+   * compressed, interleaved over the lanes of a chunk in the same way as
+   * #values. Padded entries repeat a valid column index of the same row.
+   */
+  std::vector<unsigned int> column_indices;
+
+  /**
+   * Column indices relative to the respective entry of #column_bases for the
+   * compressed chunks.
+   */
+  std::vector<std::uint16_t> column_offsets;
+
+  /**
+   * Matrix entries, interleaved over the lanes of a chunk, i.e., the $j$-th
+   * entry of lane $v$ of chunk $c$ is at position
+   * <tt>chunk_starts[c]+j*chunk_size+v</tt>. Padded entries are zero.
+   */
+  AlignedVector<Number> values;
+
+  /**
+   * The diagonal of the matrix in the original row numbering, used by
+   * precondition_Jacobi() and diag_element(). Empty for non-quadratic
+   * matrices.
+   */
+  AlignedVector<Number> diagonal;
+};
+
+/** @} */
+
+//---------------------------------------------------------------------------
+#ifndef DOXYGEN
+
+template <typename Number>
+SlicedEllpackMatrix<Number>::SlicedEllpackMatrix()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+  , sigma(1)
+  , rows_are_permuted(false)
+{}
+
+
+
+template <typename Number>
+template <typename Number2>
+SlicedEllpackMatrix<Number>::SlicedEllpackMatrix(
+  const SparseMatrix<Number2> &matrix,
+  const unsigned int           sigma,
+  const bool                   compress_column_indices)
+  : SlicedEllpackMatrix()
+{
+  reinit(matrix, sigma, compress_column_indices);
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::reinit(const SparsityPattern &sparsity,
+                                    const unsigned int     sigma,
+                                    const bool compress_column_indices)
+{
+  Assert(sigma > 0, ExcMessage("The sorting scope sigma must be positive."));
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  AssertThrow(sparsity.n_cols() <
+                static_cast<size_type>(numbers::invalid_unsigned_int),
+              ExcTooManyColumns());
+
+  n_rows            = sparsity.n_rows();
+  n_cols            = sparsity.n_cols();
+  n_nonzeros        = sparsity.n_nonzero_elements();
+  this->sigma       = sigma;
+  rows_are_permuted = false;
+
+  // sort the rows by decreasing length within windows of sigma rows
+  const size_type n_chunks = (n_rows + chunk_size - 1) / chunk_size;
+  std::vector<size_type> permutation(n_rows);
+  std::iota(permutation.begin(), permutation.end(), size_type(0));
+  if (sigma > 1)
+    {
+      for (size_type start = 0; start < n_rows; start += sigma)
+        std::stable_sort(permutation.begin() + start,
+                         permutation.begin() + std::min<size_type>(n_rows,
+                                                                   start +
+                                                                     sigma),
+                         [&](const size_type a, const size_type b) {
+                           return sparsity.row_length(a) >
+                                  sparsity.row_length(b);
+                         });
+      for (size_type i = 0; i < n_rows; ++i)
+        if (permutation[i] != i)
+          {
+            rows_are_permuted = true;
+            break;
+          }
+    }
+
+  row_indices.clear();
+  row_indices.resize(n_chunks * chunk_size, numbers::invalid_size_type);
+  row_lengths.clear();
+  row_lengths.resize(n_chunks * chunk_size, 0);
+  for (size_type i = 0; i < n_rows; ++i)
+    {
+      row_indices[i] = permutation[i];
+      row_lengths[i] = sparsity.row_length(permutation[i]);
+    }
+
+  chunk_starts.resize(n_chunks + 1);
+  chunk_starts[0] = 0;
+  for (size_type c = 0; c < n_chunks; ++c)
+    {
+      const unsigned int chunk_length =
+        *std::max_element(row_lengths.begin() + c * chunk_size,
+                          row_lengths.begin() + (c + 1) * chunk_size);
+      chunk_starts[c + 1] =
+        chunk_starts[c] + std::size_t(chunk_length) * chunk_size;
+    }
+
+  values.resize_fast(chunk_starts.back());
+  values.fill(Number());
+
+  column_bases.resize(n_chunks);
+  column_starts.resize(n_chunks);
+  column_indices.clear();
+  column_offsets.clear();
+  std::vector<unsigned int> chunk_columns;
+  for (size_type c = 0; c < n_chunks; ++c)
+    {
+      const unsigned int chunk_length =
+        (chunk_starts[c + 1] - chunk_starts[c]) / chunk_size;
+      chunk_columns.resize(std::size_t(chunk_length) * chunk_size);
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const size_type row = row_indices[c * chunk_size + v];
+          unsigned int   *col = chunk_columns.data() + v;
+
+          // padded entries read the last valid column of the same row, or
+          // the first column for empty rows, to keep the gather in bounds
+          unsigned int j = 0;
+          if (row != numbers::invalid_size_type)
+            for (auto it = sparsity.begin(row); it != sparsity.end(row);
+                 ++it, ++j)
+              col[j * chunk_size] = it->column();
+          const unsigned int fill = (j > 0) ? col[(j - 1) * chunk_size] : 0;
+          for (; j < chunk_length; ++j)
+            col[j * chunk_size] = fill;
+        }
+
+      const auto [min_column, max_column] =
+        std::minmax_element(chunk_columns.begin(), chunk_columns.end());
+      if (compress_column_indices && chunk_length > 0 &&
+          *max_column - *min_column <=
+            std::numeric_limits<std::uint16_t>::max())
+        {
+          column_bases[c]  = *min_column;
+          column_starts[c] = column_offsets.size();
+          for (const unsigned int col : chunk_columns)
+            column_offsets.push_back(col - *min_column);
+        }
+      else
+        {
+          column_bases[c]  = numbers::invalid_unsigned_int;
+          column_starts[c] = column_indices.size();
+          column_indices.insert(column_indices.end(),
+                                chunk_columns.begin(),
+                                chunk_columns.end());
+        }
+    }
+  column_indices.shrink_to_fit();
+  column_offsets.shrink_to_fit();
+
+  if (n_rows == n_cols)
+    {
+      diagonal.resize_fast(n_rows);
+      diagonal.fill(Number());
+    }
+  else
+    diagonal.clear();
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+void
+SlicedEllpackMatrix<Number>::reinit(const SparseMatrix<Number2> &matrix,
+                                    const unsigned int           sigma,
+                                    const bool compress_column_indices)
+{
+  reinit(matrix.get_sparsity_pattern(), sigma, compress_column_indices);
+  copy_from(matrix);
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+void
+SlicedEllpackMatrix<Number>::copy_from(const SparseMatrix<Number2> &matrix)
+{
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+  AssertDimension(matrix.get_sparsity_pattern().n_nonzero_elements(),
+                  n_nonzeros);
+
+  const size_type n_chunks = chunk_starts.size() - 1;
+  for (size_type c = 0; c < n_chunks; ++c)
+    for (unsigned int v = 0; v < chunk_size; ++v)
+      {
+        const size_type row = row_indices[c * chunk_size + v];
+        if (row == numbers::invalid_size_type)
+          continue;
+        AssertDimension(matrix.get_sparsity_pattern().row_length(row),
+                        row_lengths[c * chunk_size + v]);
+
+        const std::size_t offset = chunk_starts[c] + v;
+        unsigned int      j      = 0;
+        for (auto it = matrix.begin(row); it != matrix.end(row); ++it, ++j)
+          {
+            Assert(get_column(c, j * chunk_size + v) == it->column(),
+                   ExcMessage("The sparsity pattern of the matrix does not "
+                              "match the one this object was set up with."));
+            values[offset + j * chunk_size] = Number(it->value());
+          }
+      }
+
+  if (n_rows == n_cols)
+    for (size_type i = 0; i < n_rows; ++i)
+      diagonal[i] = Number(matrix.diag_element(i));
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::clear()
+{
+  n_rows            = 0;
+  n_cols            = 0;
+  n_nonzeros        = 0;
+  sigma             = 1;
+  rows_are_permuted = false;
+  row_indices.clear();
+  row_lengths.clear();
+  chunk_starts.clear();
+  column_bases.clear();
+  column_starts.clear();
+  column_indices.clear();
+  column_offsets.clear();
+  values.clear();
+  diagonal.clear();
+}
+
+
+
+template <typename Number>
+inline bool
+SlicedEllpackMatrix<Number>::empty() const
+{
+  return n_rows == 0 || n_cols == 0;
+}
+
+
+
+template <typename Number>
+inline typename SlicedEllpackMatrix<Number>::size_type
+SlicedEllpackMatrix<Number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename Number>
+inline typename SlicedEllpackMatrix<Number>::size_type
+SlicedEllpackMatrix<Number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename Number>
+inline std::size_t
+SlicedEllpackMatrix<Number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename Number>
+inline std::size_t
+SlicedEllpackMatrix<Number>::n_stored_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename Number>
+inline unsigned int
+SlicedEllpackMatrix<Number>::get_sigma() const
+{
+  return sigma;
+}
+
+
+
+template <typename Number>
+inline unsigned int
+SlicedEllpackMatrix<Number>::n_chunks_with_compressed_indices() const
+{
+  return std::count_if(column_bases.begin(),
+                       column_bases.end(),
+                       [](const unsigned int base) {
+                         return base != numbers::invalid_unsigned_int;
+                       });
+}
+
+
+
+template <typename Number>
+inline unsigned int
+SlicedEllpackMatrix<Number>::get_column(const size_type   chunk,
+                                        const std::size_t index) const
+{
+  if (column_bases[chunk] == numbers::invalid_unsigned_int)
+    return column_indices[column_starts[chunk] + index];
+  else
+    return column_bases[chunk] + column_offsets[column_starts[chunk] + index];
+}
+
+
+
+template <typename Number>
+inline Number
+SlicedEllpackMatrix<Number>::diag_element(const size_type i) const
+{
+  Assert(m() == n(), ExcNotQuadratic());
+  AssertIndexRange(i, m());
+  return diagonal[i];
+}
+
+
+
+template <typename Number>
+void
+SlicedEllpackMatrix<Number>::vmult_on_subrange(const unsigned int begin_chunk,
+                                               const unsigned int end_chunk,
+                                               const Number      *src,
+                                               Number            *dst,
+                                               const bool         add) const
+{
+  for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+    {
+      const Number     *val    = values.data() + chunk_starts[c];
+      const std::size_t length = chunk_starts[c + 1] - chunk_starts[c];
+
+      VectorizedArray<Number> sum = Number();
+      if (column_bases[c] == numbers::invalid_unsigned_int)
+        {
+          const unsigned int *col = column_indices.data() + column_starts[c];
+          for (std::size_t j = 0; j < length; j += chunk_size)
+            {
+              VectorizedArray<Number> matrix_entries, source_entries;
+              matrix_entries.load(val + j);
+              source_entries.gather(src, col + j);
+              sum += matrix_entries * source_entries;
+            }
+        }
+      else
+        {
+          // gather with the 16-bit offsets relative to the first column of
+          // the chunk, which are widened inside the gather operation
+          const std::uint16_t *offsets =
+            column_offsets.data() + column_starts[c];
+          const Number *src_chunk = src + column_bases[c];
+          for (std::size_t j = 0; j < length; j += chunk_size)
+            {
+              VectorizedArray<Number> matrix_entries, source_entries;
+              matrix_entries.load(val + j);
+              source_entries.gather(src_chunk, offsets + j);
+              sum += matrix_entries * source_entries;
+            }
+        }
+
+      const size_type first_row = size_type(c) * chunk_size;
+      if (rows_are_permuted == false && first_row + chunk_size <= n_rows)
+        {
+          if (add)
+            {
+              VectorizedArray<Number> old;
+              old.load(dst + first_row);
+              sum += old;
+            }
+          sum.store(dst + first_row);
+        }
+      else
+        for (unsigned int v = 0; v < chunk_size; ++v)
+          {
+            const size_type row = row_indices[first_row + v];
+            if (row == numbers::invalid_size_type)
+              continue;
+            if (add)
+              dst[row] += sum[v];
+            else
+              dst[row] = sum[v];
+          }
+    }
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+void
+SlicedEllpackMatrix<Number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  static_assert(std::is_same_v<typename VectorType::value_type, Number>,
+                "The vectors must have the same number type as the matrix.");
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const Number *src_ptr = src.begin();
+  Number       *dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(chunk_starts.size() - 1),
+    [this, src_ptr, dst_ptr](const unsigned int begin_chunk,
+                             const unsigned int end_chunk) {
+      vmult_on_subrange(begin_chunk, end_chunk, src_ptr, dst_ptr, false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+void
+SlicedEllpackMatrix<Number>::vmult_add(VectorType       &dst,
+                                       const VectorType &src) const
+{
+  static_assert(std::is_same_v<typename VectorType::value_type, Number>,
+                "The vectors must have the same number type as the matrix.");
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const Number *src_ptr = src.begin();
+  Number       *dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(chunk_starts.size() - 1),
+    [this, src_ptr, dst_ptr](const unsigned int begin_chunk,
+                             const unsigned int end_chunk) {
+      vmult_on_subrange(begin_chunk, end_chunk, src_ptr, dst_ptr, true);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+void
+SlicedEllpackMatrix<Number>::Tvmult(VectorType       &dst,
+                                    const VectorType &src) const
+{
+  dst = Number();
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+void
+SlicedEllpackMatrix<Number>::Tvmult_add(VectorType       &dst,
+                                        const VectorType &src) const
+{
+  static_assert(std::is_same_v<typename VectorType::value_type, Number>,
+                "The vectors must have the same number type as the matrix.");
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const Number   *src_ptr  = src.begin();
+  Number         *dst_ptr  = dst.begin();
+  const size_type n_chunks = chunk_starts.size() - 1;
+  for (size_type c = 0; c < n_chunks; ++c)
+    for (unsigned int v = 0; v < chunk_size; ++v)
+      {
+        const size_type row = row_indices[c * chunk_size + v];
+        if (row == numbers::invalid_size_type)
+          continue;
+        const Number       src_row = src_ptr[row];
+        const std::size_t  offset  = chunk_starts[c] + v;
+        const unsigned int length  = row_lengths[c * chunk_size + v];
+        for (unsigned int j = 0; j < length; ++j)
+          dst_ptr[get_column(c, j * chunk_size + v)] +=
+            values[offset + j * chunk_size] * src_row;
+      }
+}
+
+
+
+template <typename Number>
+template <typename VectorType>
+void
+SlicedEllpackMatrix<Number>::precondition_Jacobi(VectorType       &dst,
+                                                 const VectorType &src,
+                                                 const Number      omega) const
+{
+  Assert(m() == n(), ExcNotQuadratic());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+
+  const Number *src_ptr  = src.begin();
+  Number       *dst_ptr  = dst.begin();
+  const Number *diag_ptr = diagonal.data();
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_rows,
+    [=](const size_type begin, const size_type end) {
+      if (omega != Number(1.))
+        for (size_type i = begin; i < end; ++i)
+          dst_ptr[i] = omega * src_ptr[i] / diag_ptr[i];
+      else
+        for (size_type i = begin; i < end; ++i)
+          dst_ptr[i] = src_ptr[i] / diag_ptr[i];
+    },
+    internal::VectorImplementation::minimum_parallel_grain_size);
+}
+
+
+
+template <typename Number>
+std::size_t
+SlicedEllpackMatrix<Number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_indices) +
+         MemoryConsumption::memory_consumption(row_lengths) +
+         MemoryConsumption::memory_consumption(chunk_starts) +
+         MemoryConsumption::memory_consumption(column_bases) +
+         MemoryConsumption::memory_consumption(column_starts) +
+         MemoryConsumption::memory_consumption(column_indices) +
+         MemoryConsumption::memory_consumption(column_offsets) +
+         values.memory_consumption() + diagonal.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
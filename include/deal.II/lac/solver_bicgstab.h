@@ -21,6 +21,7 @@
 #include <deal.II/base/signaling_nan.h>
 #include <deal.II/base/template_constraints.h>
 
+#include <deal.II/lac/fused_vector_operations.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 
@@ -321,15 +322,20 @@ typename SolverBicgstab<VectorType>::IterationResult
 
   rbar = r;
 
-  value_type alpha = 1.;
-  value_type rho   = 1.;
-  value_type omega = 1.;
+  value_type alpha      = 1.;
+  value_type rho        = 1.;
+  value_type omega      = 1.;
+  value_type r_dot_rbar = res * res;
+
+  // Merges the vector updates and inner products into few sweeps through the
+  // vectors
+  LinearAlgebra::FusedVectorOperations<VectorType> operations;
 
   do
     {
       ++step;
 
-      const value_type rhobar = (step == 1 + last_step) ? res * res : r * rbar;
+      const value_type rhobar = r_dot_rbar;
 
       if (std::fabs(rhobar) < additional_data.breakdown)
         {
@@ -343,10 +349,7 @@ typename SolverBicgstab<VectorType>::IterationResult
           p = r;
         }
       else
-        {
-          p.sadd(beta, 1., r);
-          p.add(-beta * omega, v);
-        }
+        operations.sadd(p, beta, 1., r, -beta * omega, v).execute();
 
       preconditioner.vmult(y, p);
       A.vmult(v, y);
@@ -375,22 +378,34 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       preconditioner.vmult(z, r);
       A.vmult(t, z);
-      const value_type t_dot_r   = t * r;
-      const real_type  t_squared = t * t;
+      const unsigned int index_t_dot_r = operations.dot(t, r);
+      const unsigned int index_t_dot_t = operations.dot(t, t);
+      const auto        &products      = operations.execute();
+      const value_type   t_dot_r       = products[index_t_dot_r];
+      const real_type    t_squared     = products[index_t_dot_t];
       if (t_squared < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
         }
       omega = t_dot_r / t_squared;
-      x.add(alpha, y, omega, z);
 
+      // update the solution and the residual in one sweep, computing the
+      // inner products needed for the residual norm and for the next
+      // iteration at the same time
+      operations.add(x, alpha, y, omega, z).add(r, -omega, t);
+      const unsigned int index_r_dot_rbar = operations.dot(r, rbar);
       if (additional_data.exact_residual)
         {
-          r.add(-omega, t);
-          res = criterion(A, x, b, t);
+          r_dot_rbar = operations.execute()[index_r_dot_rbar];
+          res        = criterion(A, x, b, t);
         }
       else
-        res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
+        {
+          const unsigned int index_r_dot_r = operations.dot(r, r);
+          const auto        &results       = operations.execute();
+          r_dot_rbar                       = results[index_r_dot_rbar];
+          res = std::sqrt(real_type(results[index_r_dot_r]));
+        }
 
       state = this->iteration_status(step, res, x);
       print_vectors(step, x, r, y);
@@ -19,15 +19,19 @@
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
 
+#include <deal.II/lac/fused_vector_operations.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/tridiagonal_matrix.h>
 
 #include <boost/signals2.hpp>
 
+#include <array>
 #include <cmath>
 
 DEAL_II_NAMESPACE_OPEN
@@ -190,6 +194,37 @@ namespace LinearAlgebra
  * <a
  * href="https://en.wikipedia.org/wiki/Conjugate_gradient_method#Explicit_residual_calculation">link
  * here</a>.
+ *
+ * <h3>Communication-hiding variants</h3>
+ *
+ * The standard CG iteration computes two inner products per iteration, each
+ * of which requires a global reduction that waits for all processes when run
+ * in parallel. On large numbers of MPI ranks, the latency of these
+ * reductions can dominate the run time. AdditionalData::variant selects one
+ * of two reformulations of the preconditioned CG method that need only a
+ * single, fused reduction of three inner products per iteration:
+ * <ul>
+ * <li> Variant::chronopoulos_gear implements the CG variant of
+ * @cite Chronopoulos1989, which recursively updates the product of the
+ * matrix with the search direction and thereby computes all inner products
+ * of an iteration after the matrix-vector product. </li>
+ * <li> Variant::pipelined implements the pipelined CG method by Ghysels and
+ * Vanroose (Parallel Computing 40, 2014), which additionally starts the
+ * reduction before the next application of the preconditioner and the
+ * matrix and only waits for its result afterwards. For
+ * LinearAlgebra::distributed::Vector, the reduction is issued as a
+ * non-blocking `MPI_Iallreduce`, such that the communication overlaps with
+ * the operator application. This comes at the cost of four additional
+ * vectors and additional vector updates per iteration. </li>
+ * </ul>
+ * Both variants are mathematically equivalent to the standard algorithm, but
+ * the recurrences accumulate rounding errors differently, which limits the
+ * attainable accuracy of the pipelined variant for very tight tolerances.
+ * The variants check convergence with the unpreconditioned residual norm
+ * like the standard algorithm. They do not support the flexible formula of
+ * SolverFlexibleCG, explicit residuals, or the signals for the CG
+ * coefficients and eigenvalue estimates. The optimized operations described
+ * above for matrices with special capabilities are not used either.
  */
 template <typename VectorType = Vector<double>>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
@@ -201,6 +236,31 @@ public:
    */
   using size_type = types::global_dof_index;
 
+  /**
+   * Variants of the conjugate gradient iteration, see the section on
+   * communication-hiding variants in the general documentation of this
+   * class.
+   */
+  enum class Variant
+  {
+    /**
+     * The standard preconditioned CG method with two global reductions per
+     * iteration.
+     */
+    standard,
+    /**
+     * The CG method by Chronopoulos and Gear with a single global reduction
+     * per iteration.
+     */
+    chronopoulos_gear,
+    /**
+     * The pipelined CG method by Ghysels and Vanroose, which overlaps the
+     * single global reduction of an iteration with the application of the
+     * preconditioner and the matrix.
+     */
+    pipelined
+  };
+
 
   /**
    * Standardized data struct to pipe additional data to the solver.
@@ -219,14 +279,21 @@ public:
      * information on explicit and implicit residual stopping criteria can be
      * found <a
      * href="https://en.wikipedia.org/wiki/Conjugate_gradient_method#Explicit_residual_calculation">link
-     * here</a>.
+     * here</a>. The second argument selects the variant of the CG
+     * iteration.
      */
-    explicit AdditionalData(const bool use_default_residual = true);
+    explicit AdditionalData(const bool    use_default_residual = true,
+                            const Variant variant = Variant::standard);
 
     /**
      * Flag for the default residual that is used to measure convergence.
      */
     bool use_default_residual;
+
+    /**
+     * The variant of the CG iteration.
+     */
+    Variant variant;
   };
 
 
@@ -260,6 +327,31 @@ public:
              const VectorType         &b,
              const PreconditionerType &preconditioner);
 
+  /**
+   * Solve the linear systems $Ax_k=b_k$ for several right hand sides $b_k$
+   * at once. The conjugate gradient iterations for the individual systems
+   * are run side by side, such that the matrix-vector products of all
+   * systems are computed by a single call to
+   * <code>A.vmult_multiple(std::vector<VectorType> &, const
+   * std::vector<VectorType> &)</code> if the matrix provides this function,
+   * as SparseMatrix does. This reads the matrix only once per iteration for
+   * all right hand sides and is thus considerably faster than separate
+   * solves for memory-bound matrices. For other matrix types, vmult() is
+   * called for each vector.
+   *
+   * The SolverControl object is checked with the largest residual norm
+   * among all systems, i.e., the solver stops once all systems have
+   * converged. Systems whose residual has become exactly zero are not
+   * updated any more. The signals for the CG coefficients and eigenvalue
+   * estimates are not called by this function.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType              &A,
+        std::vector<VectorType>       &x,
+        const std::vector<VectorType> &b,
+        const PreconditionerType      &preconditioner);
+
   /**
    * Connect a slot to retrieve the CG coefficients. The slot will be called
    * with alpha as the first argument and with beta as the second argument,
@@ -304,6 +396,17 @@ protected:
                 const VectorType  &r,
                 const VectorType  &d) const;
 
+  /**
+   * Run the single-reduction variants of the CG method selected by
+   * AdditionalData::variant.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve_single_reduction(const MatrixType         &A,
+                         VectorType               &x,
+                         const VectorType         &b,
+                         const PreconditionerType &preconditioner);
+
   /**
    * Estimates the eigenvalues from diagonal and offdiagonal. Uses these
    * estimate to compute the condition number. Calls the signals
@@ -463,8 +566,10 @@ protected:
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 inline SolverCG<VectorType>::AdditionalData::AdditionalData(
-  const bool use_default_residual)
+  const bool    use_default_residual,
+  const Variant variant)
   : use_default_residual(use_default_residual)
+  , variant(variant)
 {}
 
 template <typename VectorType>
@@ -707,13 +812,29 @@ namespace internal
         const Number previous_r_dot_preconditioner_dot_r =
           r_dot_preconditioner_dot_r;
 
+        // the inner product of the flexible variant is computed in the same
+        // sweep through the vectors as the one of the preconditioned residual
+        Number r_dot_z = Number();
         if (std::is_same_v<PreconditionerType, PreconditionIdentity> == false)
           {
             preconditioner.vmult(v, r);
-            r_dot_preconditioner_dot_r = r * v;
+            const unsigned int index_r_dot_v = operations.dot(r, v);
+            if (this->flexible && iteration_index > 1)
+              {
+                const unsigned int index_r_dot_z = operations.dot(r, z);
+                const auto        &results       = operations.execute();
+                r_dot_z = results[index_r_dot_z];
+                r_dot_preconditioner_dot_r = results[index_r_dot_v];
+              }
+            else
+              r_dot_preconditioner_dot_r = operations.execute()[index_r_dot_v];
           }
         else
-          r_dot_preconditioner_dot_r = residual_norm * residual_norm;
+          {
+            r_dot_preconditioner_dot_r = residual_norm * residual_norm;
+            if (this->flexible && iteration_index > 1)
+              r_dot_z = r * z;
+          }
 
         const VectorType &direction =
           std::is_same_v<PreconditionerType, PreconditionIdentity> ? r : v;
@@ -725,7 +846,7 @@ namespace internal
             beta =
               r_dot_preconditioner_dot_r / previous_r_dot_preconditioner_dot_r;
             if (this->flexible)
-              beta -= (r * z) / previous_r_dot_preconditioner_dot_r;
+              beta -= r_dot_z / previous_r_dot_preconditioner_dot_r;
             p.sadd(beta, 1., direction);
           }
         else
@@ -742,19 +863,20 @@ namespace internal
         this->previous_alpha = alpha;
         alpha                = r_dot_preconditioner_dot_r / p_dot_A_dot_p;
 
-        x.add(alpha, p);
-
-        // compute the residual norm with implicit residual
+        // update the solution and the residual in a single sweep, together
+        // with the norm of the implicit residual
+        operations.add(x, alpha, p).add(r, -alpha, v);
         if (use_default_residual)
           {
-            residual_norm = std::sqrt(std::abs(r.add_and_dot(-alpha, v, r)));
+            const unsigned int index_r_dot_r = operations.dot(r, r);
+            residual_norm =
+              std::sqrt(std::abs(operations.execute()[index_r_dot_r]));
           }
         // compute the residual norm with the explicit residual, i.e.
         // compute l2 norm of Ax - b.
         else
           {
-            // compute the residual conjugate gradient update
-            r.add(-alpha, v);
+            operations.execute();
             // compute explicit residual
             A.vmult(explicit_r, x);
             explicit_r.add(-1, b);
@@ -765,6 +887,10 @@ namespace internal
       void
       finalize_after_convergence(const unsigned int)
       {}
+
+      // Object to merge the vector updates and inner products of an
+      // iteration into as few sweeps through the vectors as possible
+      LinearAlgebra::FusedVectorOperations<VectorType> operations;
     };
 
 
@@ -1377,6 +1503,146 @@ namespace internal
           }
       }
     };
+
+
+    // a helper type-trait that leverage SFINAE to figure out if MatrixType has
+    // ... MatrixType::vmult_multiple(std::vector<VectorType> &, const
+    // std::vector<VectorType> &) const
+    template <typename MatrixType, typename VectorType>
+    using vmult_multiple_t =
+      decltype(std::declval<const MatrixType>().vmult_multiple(
+        std::declval<std::vector<VectorType> &>(),
+        std::declval<const std::vector<VectorType> &>()));
+
+    template <typename MatrixType, typename VectorType>
+    constexpr bool has_vmult_multiple =
+      is_supported_operation<vmult_multiple_t, MatrixType, VectorType>;
+
+
+    // Apply the matrix to several vectors, using a fused product over all
+    // vectors if the matrix provides one
+    template <typename MatrixType, typename VectorType>
+    void
+    vmult_multiple(const MatrixType              &A,
+                   std::vector<VectorType>       &dst,
+                   const std::vector<VectorType> &src)
+    {
+      if constexpr (has_vmult_multiple<MatrixType, VectorType>)
+        A.vmult_multiple(dst, src);
+      else
+        for (unsigned int k = 0; k < src.size(); ++k)
+          A.vmult(dst[k], src[k]);
+    }
+
+
+
+    // a helper type-trait to identify LinearAlgebra::distributed::Vector with
+    // data on the host, whose locally owned entries can be accessed directly
+    template <typename VectorType>
+    struct is_host_distributed_vector : std::false_type
+    {};
+
+    template <typename Number>
+    struct is_host_distributed_vector<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+      : std::true_type
+    {};
+
+
+
+    // Compute the three inner products (r,u), (w,u), and (r,r) needed by the
+    // single-reduction variants of CG with one global reduction. For
+    // LinearAlgebra::distributed::Vector, the local contributions are
+    // computed in a single sweep through the three vectors and summed with a
+    // non-blocking MPI_Iallreduce, such that other work can be done between
+    // start() and finish(). For other vector types, the inner products are
+    // computed by the vector class in start().
+    template <typename VectorType>
+    class FusedInnerProducts
+    {
+    public:
+      using Number = typename VectorType::value_type;
+
+      FusedInnerProducts()
+        : results{}
+#ifdef DEAL_II_WITH_MPI
+        , request(MPI_REQUEST_NULL)
+#endif
+      {}
+
+      ~FusedInnerProducts()
+      {
+#ifdef DEAL_II_WITH_MPI
+        // only reached with a pending request if an exception was thrown
+        // between start() and finish()
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+      }
+
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        if constexpr (is_host_distributed_vector<VectorType>::value)
+          {
+            const Number      *r_ptr = r.begin();
+            const Number      *u_ptr = u.begin();
+            const Number      *w_ptr = w.begin();
+            const unsigned int size  = r.locally_owned_size();
+
+            Number r_dot_u = Number(), w_dot_u = Number(), r_dot_r = Number();
+            for (unsigned int i = 0; i < size; ++i)
+              {
+                const Number u_conj =
+                  numbers::NumberTraits<Number>::conjugate(u_ptr[i]);
+                r_dot_u += r_ptr[i] * u_conj;
+                w_dot_u += w_ptr[i] * u_conj;
+                r_dot_r +=
+                  r_ptr[i] * numbers::NumberTraits<Number>::conjugate(r_ptr[i]);
+              }
+            results = {{r_dot_u, w_dot_u, r_dot_r}};
+
+#ifdef DEAL_II_WITH_MPI
+            const MPI_Comm comm = r.get_mpi_communicator();
+            if (Utilities::MPI::job_supports_mpi() &&
+                Utilities::MPI::n_mpi_processes(comm) > 1)
+              {
+                const int ierr =
+                  MPI_Iallreduce(MPI_IN_PLACE,
+                                 results.data(),
+                                 results.size(),
+                                 Utilities::MPI::mpi_type_id_for_type<Number>,
+                                 MPI_SUM,
+                                 comm,
+                                 &request);
+                AssertThrowMPI(ierr);
+              }
+#endif
+          }
+        else
+          results = {{r * u, w * u, r.norm_sqr()}};
+      }
+
+      const std::array<Number, 3> &
+      finish()
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#endif
+        return results;
+      }
+
+    private:
+      std::array<Number, 3> results;
+
+#ifdef DEAL_II_WITH_MPI
+      MPI_Request request;
+#endif
+    };
   } // namespace SolverCG
 } // namespace internal
 
@@ -1395,6 +1661,12 @@ void SolverCG<VectorType>::solve(const MatrixType         &A,
 {
   using number = typename VectorType::value_type;
 
+  if (additional_data.variant != Variant::standard)
+    {
+      solve_single_reduction(A, x, b, preconditioner);
+      return;
+    }
+
   SolverControl::State solver_state = SolverControl::iterate;
 
   LogStream::Prefix prefix("cg");
@@ -1471,6 +1743,317 @@ void SolverCG<VectorType>::solve(const MatrixType         &A,
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+void SolverCG<VectorType>::solve(const MatrixType              &A,
+                                 std::vector<VectorType>       &x,
+                                 const std::vector<VectorType> &b,
+                                 const PreconditionerType      &preconditioner)
+{
+  using number = typename VectorType::value_type;
+
+  AssertDimension(x.size(), b.size());
+  const unsigned int n_vectors = x.size();
+  if (n_vectors == 0)
+    return;
+
+  LogStream::Prefix prefix("cg");
+
+  constexpr bool is_identity =
+    std::is_same_v<PreconditionerType, PreconditionIdentity>;
+  const bool flexible = determine_beta_by_flexible_formula;
+
+  // use the names of the single-vector variant: 'r' for the residual, 'p'
+  // for the search direction, 'v' for the preconditioned residual and the
+  // product of the matrix with the search direction, and 'z' for the
+  // previous preconditioned residual in the flexible variant
+  std::vector<VectorType> r(n_vectors), p(n_vectors), v(n_vectors),
+    z(flexible ? n_vectors : 0);
+  for (unsigned int k = 0; k < n_vectors; ++k)
+    {
+      r[k].reinit(x[k], true);
+      p[k].reinit(x[k], true);
+      v[k].reinit(x[k], true);
+      if (flexible)
+        z[k].reinit(x[k], true);
+    }
+
+  internal::SolverCG::vmult_multiple(A, r, x);
+
+  std::vector<double> residual_norms(n_vectors);
+  std::vector<number> r_dot_preconditioner_dot_r(n_vectors);
+  for (unsigned int k = 0; k < n_vectors; ++k)
+    {
+      r[k].sadd(-1., 1., b[k]);
+      residual_norms[k] = r[k].l2_norm();
+    }
+
+  const auto max_residual = [&]() {
+    return std::max_element(residual_norms.begin(), residual_norms.end()) -
+           residual_norms.begin();
+  };
+
+  unsigned int         k_max = max_residual();
+  SolverControl::State solver_state =
+    this->iteration_status(0, residual_norms[k_max], x[k_max]);
+
+  unsigned int it = 0;
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      for (unsigned int k = 0; k < n_vectors; ++k)
+        {
+          if (residual_norms[k] == 0.)
+            continue;
+
+          const number previous_r_dot_preconditioner_dot_r =
+            r_dot_preconditioner_dot_r[k];
+
+          if (is_identity == false)
+            {
+              preconditioner.vmult(v[k], r[k]);
+              r_dot_preconditioner_dot_r[k] = r[k] * v[k];
+            }
+          else
+            r_dot_preconditioner_dot_r[k] =
+              residual_norms[k] * residual_norms[k];
+
+          const VectorType &direction = is_identity ? r[k] : v[k];
+
+          if (it > 1)
+            {
+              Assert(std::abs(previous_r_dot_preconditioner_dot_r) != 0.,
+                     ExcDivideByZero());
+              number beta = r_dot_preconditioner_dot_r[k] /
+                            previous_r_dot_preconditioner_dot_r;
+              if (flexible)
+                beta -= (r[k] * z[k]) / previous_r_dot_preconditioner_dot_r;
+              p[k].sadd(beta, 1., direction);
+            }
+          else
+            p[k].equ(1., direction);
+
+          if (flexible)
+            z[k].swap(v[k]);
+        }
+
+      internal::SolverCG::vmult_multiple(A, v, p);
+
+      for (unsigned int k = 0; k < n_vectors; ++k)
+        {
+          if (residual_norms[k] == 0.)
+            continue;
+
+          const number p_dot_A_dot_p = p[k] * v[k];
+          Assert(std::abs(p_dot_A_dot_p) != 0., ExcDivideByZero());
+
+          const number alpha = r_dot_preconditioner_dot_r[k] / p_dot_A_dot_p;
+          x[k].add(alpha, p[k]);
+          residual_norms[k] =
+            std::sqrt(std::abs(r[k].add_and_dot(-alpha, v[k], r[k])));
+        }
+
+      k_max = max_residual();
+      print_vectors(it, x[k_max], r[k_max], p[k_max]);
+      solver_state =
+        this->iteration_status(it, residual_norms[k_max], x[k_max]);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norms[k_max]));
+}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+void SolverCG<VectorType>::solve_single_reduction(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using number = typename VectorType::value_type;
+
+  Assert(determine_beta_by_flexible_formula == false,
+         ExcMessage("The flexible variant of CG is not available with the "
+                    "single-reduction variants of SolverCG."));
+  Assert(additional_data.use_default_residual,
+         ExcMessage("The explicit residual is not available with the "
+                    "single-reduction variants of SolverCG."));
+
+  LogStream::Prefix prefix("cg");
+
+  constexpr bool is_identity =
+    std::is_same_v<PreconditionerType, PreconditionIdentity>;
+  const bool pipelined = additional_data.variant == Variant::pipelined;
+
+  // The notation follows Algorithms 3 and 4 of Ghysels and Vanroose: 'r' is
+  // the residual, 'u' the preconditioned residual, 'w' the product of A with
+  // u, 'p' the search direction and 's' the product of A with p. The
+  // pipelined variant additionally needs 'm' as the preconditioned w, 'n' as
+  // the product of A with m, 'q' as the preconditioned s, and 'z' as the
+  // product of A with q. For the identity preconditioner, the vectors u, m,
+  // and q coincide with r, w, and s, respectively, and are not allocated.
+  using VectorPointer = typename VectorMemory<VectorType>::Pointer;
+  VectorPointer r_pointer(this->memory), w_pointer(this->memory),
+    p_pointer(this->memory), s_pointer(this->memory);
+  VectorPointer u_pointer, m_pointer, n_pointer, q_pointer, z_pointer;
+  if (is_identity == false)
+    u_pointer = VectorPointer(this->memory);
+  if (pipelined)
+    {
+      n_pointer = VectorPointer(this->memory);
+      z_pointer = VectorPointer(this->memory);
+      if (is_identity == false)
+        {
+          m_pointer = VectorPointer(this->memory);
+          q_pointer = VectorPointer(this->memory);
+        }
+    }
+
+  VectorType &r = *r_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &u = is_identity ? r : *u_pointer;
+
+  r.reinit(x, true);
+  w.reinit(x, true);
+  p.reinit(x, true);
+  s.reinit(x, true);
+  if (is_identity == false)
+    u.reinit(x, true);
+  if (pipelined)
+    {
+      n_pointer->reinit(x, true);
+      z_pointer->reinit(x, true);
+      if (is_identity == false)
+        {
+          m_pointer->reinit(x, true);
+          q_pointer->reinit(x, true);
+        }
+    }
+
+  // compute the products (r,u), (w,u) and (r,r) and, for the pipelined
+  // variant, the next application of the preconditioner and the matrix
+  // while the reduction is in flight
+  internal::SolverCG::FusedInnerProducts<VectorType> inner_products;
+  const auto compute_inner_products = [&]() -> const std::array<number, 3> & {
+    inner_products.start(r, u, w);
+    if (pipelined)
+      {
+        VectorType &m = is_identity ? w : *m_pointer;
+        if (is_identity == false)
+          preconditioner.vmult(m, w);
+        A.vmult(*n_pointer, m);
+      }
+    return inner_products.finish();
+  };
+
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+  if (is_identity == false)
+    preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  std::array<number, 3> products = compute_inner_products();
+
+  double residual_norm = std::sqrt(std::abs(products[2]));
+
+  SolverControl::State solver_state =
+    this->iteration_status(0, residual_norm, x);
+
+  number gamma          = products[0];
+  number delta          = products[1];
+  number previous_gamma = number();
+  number alpha          = number();
+
+  unsigned int it = 0;
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      number beta = number();
+      if (it > 1)
+        {
+          Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+          beta = gamma / previous_gamma;
+          const number denominator = delta - beta * gamma / alpha;
+          Assert(std::abs(denominator) != 0., ExcDivideByZero());
+          alpha = gamma / denominator;
+
+          p.sadd(beta, 1., u);
+          s.sadd(beta, 1., w);
+        }
+      else
+        {
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          alpha = gamma / delta;
+
+          p.equ(1., u);
+          s.equ(1., w);
+        }
+
+      x.add(alpha, p);
+      r.add(-alpha, s);
+
+      if (pipelined)
+        {
+          // update the preconditioned residual and its product with the
+          // matrix by recurrences, rather than computing them after the
+          // residual is known
+          VectorType &n = *n_pointer;
+          VectorType &z = *z_pointer;
+          if (it > 1)
+            z.sadd(beta, 1., n);
+          else
+            z.equ(1., n);
+          w.add(-alpha, z);
+
+          if (is_identity == false)
+            {
+              VectorType &m = *m_pointer;
+              VectorType &q = *q_pointer;
+              if (it > 1)
+                q.sadd(beta, 1., m);
+              else
+                q.equ(1., m);
+              u.add(-alpha, q);
+            }
+        }
+      else
+        {
+          if (is_identity == false)
+            preconditioner.vmult(u, r);
+          A.vmult(w, u);
+        }
+
+      print_vectors(it, x, r, p);
+
+      products       = compute_inner_products();
+      previous_gamma = gamma;
+      gamma          = products[0];
+      delta          = products[1];
+      residual_norm  = std::sqrt(std::abs(products[2]));
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+
+
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 boost::signals2::connection SolverCG<VectorType>::connect_coefficients_slot(
@@ -178,6 +178,38 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Orthonormalize the @p s vectors at the positions <tt>n + 1, ..., n +
+       * s</tt> within the array @p orthogonal_vectors, which must have been
+       * generated from the orthonormal vector at position @p n by the
+       * recurrence described by the matrix @p change_of_basis of size
+       * <tt>(s+1) x s</tt>, i.e., the product of the (preconditioned) matrix
+       * with the vector at position <tt>n + k</tt> equals the linear
+       * combination of the vectors <tt>n, ..., n + s</tt> with the
+       * coefficients in column @p k of @p change_of_basis. The vectors are
+       * orthonormalized against the @p n + 1 previous vectors and among each
+       * other by block classical Gram-Schmidt with a Cholesky QR
+       * factorization, which needs a single global reduction (or two, if the
+       * new vectors are close to linearly dependent and a second pass is
+       * necessary). The columns <tt>n, ..., n + s - 1</tt> of the Hessenberg
+       * matrix are reconstructed from the triangular factors and the
+       * change-of-basis matrix and factorized by Givens rotations as in
+       * orthonormalize_nth_vector(), which must not be used with the delayed
+       * classical Gram-Schmidt variant within the same Arnoldi cycle.
+       *
+       * The function returns the residual estimate after the last of the
+       * @p s steps. If the Cholesky factorization breaks down because the
+       * new vectors are numerically linearly dependent, a negative number is
+       * returned, in which case the vectors at positions <tt>n + 1, ..., n +
+       * s</tt> are invalid and the factorization is left at step @p n.
+       */
+      template <typename VectorType>
+      double
+      orthonormalize_block(const unsigned int        n,
+                           const unsigned int        s,
+                           TmpVectors<VectorType>   &orthogonal_vectors,
+                           const FullMatrix<double> &change_of_basis);
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -407,6 +439,32 @@ namespace internal
  * can be obtained by connecting a function as a slot using @p
  * connect_condition_number_slot and @p connect_eigenvalues_slot. These slots
  * will then be called from the solver with the estimates as argument.
+ *
+ *
+ * <h3>The s-step variant</h3>
+ *
+ * Every step of the Arnoldi process needs at least one global reduction to
+ * orthogonalize the new vector against the basis, whose latency limits the
+ * strong scaling of GMRES on large parallel machines. If
+ * AdditionalData::s_step_size is set to a value $s>1$, the solver instead
+ * generates $s$ vectors $v_{k+1} = (P^{-1}A - \theta_k I) v_k$ at a time
+ * without intermediate orthogonalization (a so-called Newton basis, with
+ * $A P^{-1}$ in case of right preconditioning), and orthonormalizes them
+ * against the previous basis and among each other with block classical
+ * Gram-Schmidt and a Cholesky QR factorization in a single global reduction.
+ * The Hessenberg matrix of the Arnoldi process is then reconstructed from the
+ * triangular factors, see M. Hoemmen, "Communication-avoiding Krylov subspace
+ * methods", PhD thesis, UC Berkeley, 2010. The shifts $\theta_k$ are Ritz
+ * values of the first restart cycle, which runs the standard Arnoldi process,
+ * in modified Leja ordering, with complex conjugate pairs of Ritz values
+ * handled in real arithmetic. Convergence is checked once per block of $s$
+ * steps, such that the solver may do up to $s-1$ more iterations than the
+ * standard variant. Since the conditioning of the block of new vectors
+ * deteriorates with $s$, small values like 4 to 8 are recommended. If the
+ * Cholesky factorization breaks down, the current restart cycle is ended
+ * early; if this happens for the first block of a cycle, the solver falls
+ * back to the standard Arnoldi process. The blocks actually generated by the
+ * s-step variant can be observed with connect_s_step_block_slot().
  */
 template <typename VectorType = Vector<double>>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
@@ -436,7 +494,8 @@ public:
                             const LinearAlgebra::OrthogonalizationStrategy
                               orthogonalization_strategy =
                                 LinearAlgebra::OrthogonalizationStrategy::
-                                  delayed_classical_gram_schmidt);
+                                  delayed_classical_gram_schmidt,
+                            const unsigned int s_step_size = 1);
 
     /**
      * Maximum number of temporary vectors. Together with max_basis_size, this
@@ -499,6 +558,15 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of Krylov vectors generated per global reduction. The default
+     * value of one selects the standard Arnoldi process with the
+     * orthogonalization strategy given above. Larger values select the
+     * s-step variant described in the general documentation of this class,
+     * which is only available with the default residual.
+     */
+    unsigned int s_step_size;
   };
 
   /**
@@ -584,6 +652,16 @@ public:
   boost::signals2::connection
   connect_re_orthogonalization_slot(const std::function<void(int)> &slot);
 
+  /**
+   * Connect a slot to retrieve a notification whenever the s-step variant
+   * (see AdditionalData::s_step_size) has added a block of vectors to the
+   * Arnoldi basis. The argument is the number of vectors in the block. The
+   * slot is not called for steps of the standard Arnoldi process, including
+   * the steps after a fallback due to a breakdown.
+   */
+  boost::signals2::connection
+  connect_s_step_block_slot(const std::function<void(unsigned int)> &slot);
+
 
   DeclException1(ExcTooFewTmpVectors,
                  int,
@@ -650,6 +728,12 @@ protected:
    */
   boost::signals2::signal<void(int)> re_orthogonalize_signal;
 
+  /**
+   * Signal used to retrieve a notification when the s-step variant has
+   * added a block of vectors to the Arnoldi basis.
+   */
+  boost::signals2::signal<void(unsigned int)> s_step_block_signal;
+
   /**
    * A reference to the underlying SolverControl object. In the regular case,
    * this is not needed, as the signal from the base class is used, but the
@@ -967,7 +1051,8 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   const bool                                     use_default_residual,
   const bool                                     force_re_orthogonalization,
   const bool                                     batched_mode,
-  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy)
+  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
+  const unsigned int                             s_step_size)
   : max_n_tmp_vectors(0)
   , max_basis_size(max_basis_size)
   , right_preconditioning(right_preconditioning)
@@ -975,10 +1060,13 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step_size(s_step_size)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
                     "Arnoldi basis."));
+  Assert(s_step_size >= 1,
+         ExcMessage("The s-step size of SolverGMRES must be at least one."));
 }
 
 
@@ -1376,6 +1464,71 @@ namespace internal
 
 
 
+    // Compute the inner products of the s vectors at positions n+1, ..., n+s
+    // with all vectors at positions 0, ..., n+s and store them in the columns
+    // of the matrix gram
+    template <typename VectorType,
+              std::enable_if_t<!is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(const unsigned int            n,
+                 const unsigned int            s,
+                 const TmpVectors<VectorType> &vectors,
+                 FullMatrix<double>           &gram,
+                 std::vector<const typename VectorType::value_type *> &)
+    {
+      for (unsigned int k = 0; k < s; ++k)
+        for (unsigned int i = 0; i < n + 1 + s; ++i)
+          gram(i, k) = vectors[n + 1 + k] * vectors[i];
+    }
+
+
+
+    template <typename VectorType,
+              std::enable_if_t<is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(
+      const unsigned int                                    n,
+      const unsigned int                                    s,
+      const TmpVectors<VectorType>                         &vectors,
+      FullMatrix<double>                                   &gram,
+      std::vector<const typename VectorType::value_type *> &vector_ptrs)
+    {
+      const unsigned int n_vectors = n + 1 + s;
+
+      // collect the local contributions of all products in one array to
+      // sum them with a single global reduction
+      Vector<double> products(n_vectors * s);
+      Vector<double> tmp(n_vectors);
+      for (unsigned int b = 0; b < n_blocks(vectors[0]); ++b)
+        {
+          vector_ptrs.resize(n_vectors);
+          for (unsigned int i = 0; i < n_vectors; ++i)
+            vector_ptrs[i] = block(vectors[i], b).begin();
+
+          for (unsigned int k = 0; k < s; ++k)
+            {
+              const auto &vv = block(vectors[n + 1 + k], b);
+              tmp            = 0.;
+              do_Tvmult_add<false>(
+                n_vectors, vv.end() - vv.begin(), vv.begin(), vector_ptrs, tmp);
+              for (unsigned int i = 0; i < n_vectors; ++i)
+                products(k * n_vectors + i) += tmp(i);
+            }
+        }
+
+      Utilities::MPI::sum(products,
+                          block(vectors[0], 0).get_mpi_communicator(),
+                          products);
+
+      for (unsigned int k = 0; k < s; ++k)
+        for (unsigned int i = 0; i < n_vectors; ++i)
+          gram(i, k) = products(k * n_vectors + i);
+    }
+
+
+
     template <typename Number>
     inline void
     ArnoldiProcess<Number>::initialize(
@@ -1590,6 +1743,161 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <typename VectorType>
+    inline double
+    ArnoldiProcess<Number>::orthonormalize_block(
+      const unsigned int        n,
+      const unsigned int        s,
+      TmpVectors<VectorType>   &orthogonal_vectors,
+      const FullMatrix<double> &change_of_basis)
+    {
+      Assert(s > 0, ExcInternalError());
+      AssertIndexRange(n + s, hessenberg_matrix.m());
+      AssertIndexRange(n + s, orthogonal_vectors.size() + 1);
+      AssertDimension(givens_rotations.size(), n);
+      Assert(change_of_basis.m() >= s + 1 && change_of_basis.n() >= s,
+             ExcInternalError());
+
+      const unsigned int n_vectors = n + 1 + s;
+
+      // Compute the coefficients C of the new vectors V in the existing
+      // basis Q and the Cholesky factor R of the Gram matrix of V - Q C with
+      // the Pythagorean identity (V - Q C)^T (V - Q C) = V^T V - C^T C, and
+      // replace V by the orthonormal vectors (V - Q C) R^{-1}. Returns false
+      // if the factorization breaks down and sets the flag
+      // 'needs_second_pass' if the new vectors have lost many digits of
+      // their norm in the process, indicating that C is not accurate enough
+      // for the resulting vectors to be orthogonal.
+      bool needs_second_pass = false;
+      const auto orthonormalize_new_vectors = [&](FullMatrix<double> &C,
+                                                  FullMatrix<double> &R) {
+        FullMatrix<double> gram(n_vectors, s);
+        block_Tvmult(n, s, orthogonal_vectors, gram, vector_ptrs);
+
+        C.reinit(n + 1, s);
+        R.reinit(s, s);
+        for (unsigned int k = 0; k < s; ++k)
+          for (unsigned int i = 0; i <= n; ++i)
+            C(i, k) = gram(i, k);
+
+        for (unsigned int k = 0; k < s; ++k)
+          for (unsigned int l = k; l < s; ++l)
+            {
+              double sum = gram(n + 1 + l, k);
+              for (unsigned int i = 0; i <= n; ++i)
+                sum -= C(i, k) * C(i, l);
+              for (unsigned int i = 0; i < k; ++i)
+                sum -= R(i, k) * R(i, l);
+              if (l == k)
+                {
+                  const double norm_square = gram(n + 1 + k, k);
+                  if (!(sum > 100. * std::numeric_limits<double>::epsilon() *
+                                norm_square))
+                    return false;
+                  if (sum < 1e-4 * norm_square)
+                    needs_second_pass = true;
+                  R(k, k) = std::sqrt(sum);
+                }
+              else
+                R(k, l) = sum / R(k, k);
+            }
+
+        // apply the factors, one vector at a time as the new vectors only
+        // depend on the new vectors before them
+        h.reinit(n + s);
+        for (unsigned int k = 0; k < s; ++k)
+          {
+            for (unsigned int i = 0; i <= n; ++i)
+              h(i) = -C(i, k);
+            for (unsigned int l = 0; l < k; ++l)
+              h(n + 1 + l) = -R(l, k);
+            VectorType &vv = orthogonal_vectors[n + 1 + k];
+            add(vv, n + 1 + k, h, orthogonal_vectors, false, vector_ptrs);
+            vv /= R(k, k);
+          }
+        return true;
+      };
+
+      FullMatrix<double> C, R;
+      if (orthonormalize_new_vectors(C, R) == false)
+        return -1.;
+
+      if (needs_second_pass)
+        {
+          // combine the factors of both passes: with V = Q C + Q_1 R and
+          // Q_1 = Q C_2 + Q_2 R_2, we get V = Q (C + C_2 R) + Q_2 (R_2 R)
+          FullMatrix<double> C2, R2;
+          if (orthonormalize_new_vectors(C2, R2) == false)
+            return -1.;
+          C2.mmult(C, R, true);
+          FullMatrix<double> R_combined(s, s);
+          R2.mmult(R_combined, R);
+          R = R_combined;
+        }
+
+      // Reconstruct the Hessenberg matrix from the Arnoldi-like relation of
+      // the new vectors: With the basis Q_hat = [Q, Q_new], the vectors
+      // [v_0, ..., v_s] = Q_hat R_hat with v_0 = q_n, and the change of basis
+      // A [v_0, ..., v_{s-1}] = [v_0, ..., v_s] B, the new columns of the
+      // Hessenberg matrix are (R_hat B - [H_old X; 0]) T^{-1}, where X and T
+      // are the rows 0, ..., n-1 and n, ..., n+s-1 of the first s columns of
+      // R_hat, respectively, see Hoemmen (2010), Section 3.3.
+      FullMatrix<double> R_hat(n_vectors, s + 1);
+      R_hat(n, 0) = 1.;
+      for (unsigned int k = 0; k < s; ++k)
+        {
+          for (unsigned int i = 0; i <= n; ++i)
+            R_hat(i, k + 1) = C(i, k);
+          for (unsigned int l = 0; l <= k; ++l)
+            R_hat(n + 1 + l, k + 1) = R(l, k);
+        }
+
+      FullMatrix<double> new_columns(n_vectors, s);
+      for (unsigned int c = 0; c < s; ++c)
+        {
+          for (unsigned int i = 0; i < n_vectors; ++i)
+            {
+              double sum = 0;
+              for (unsigned int l = 0; l <= std::min(c + 1, s); ++l)
+                sum += R_hat(i, l) * change_of_basis(l, c);
+              new_columns(i, c) = sum;
+            }
+          for (unsigned int i = 0; i <= n; ++i)
+            {
+              double sum = 0;
+              for (unsigned int q = (i == 0 ? 0 : i - 1); q < n; ++q)
+                sum += hessenberg_matrix(i, q) * R_hat(q, c);
+              new_columns(i, c) -= sum;
+            }
+        }
+
+      // multiply by T^{-1} from the right by forward substitution over the
+      // columns, and store the result in the Hessenberg matrix, discarding
+      // the entries below the subdiagonal that are zero in exact arithmetic
+      for (unsigned int c = 0; c < s; ++c)
+        {
+          for (unsigned int i = 0; i <= n + c + 1; ++i)
+            {
+              double sum = new_columns(i, c);
+              for (unsigned int l = 0; l < c; ++l)
+                sum -= hessenberg_matrix(i, n + l) * R_hat(n + l, c);
+              hessenberg_matrix(i, n + c) = sum / R_hat(n + c, c);
+            }
+          for (unsigned int i = n + c + 2; i < hessenberg_matrix.m(); ++i)
+            hessenberg_matrix(i, n + c) = 0.;
+        }
+
+      double residual_estimate = 0.;
+      for (unsigned int c = 0; c < s; ++c)
+        residual_estimate = do_givens_rotation(
+          false, n + c, triangular_matrix, givens_rotations, projected_rhs);
+
+      return residual_estimate;
+    }
+
+
+
     template <typename Number>
     inline double
     ArnoldiProcess<Number>::do_givens_rotation(
@@ -1754,6 +2062,91 @@ namespace internal
       return x.real() < y.real() ||
              (x.real() == y.real() && x.imag() < y.imag());
     }
+
+
+
+    // Compute the change-of-basis matrix of size (s+1) x s of a Newton basis
+    // with s vectors, using the Ritz values of the upper left n x n block of
+    // the given Hessenberg matrix as shifts in modified Leja ordering. A
+    // complex conjugate pair of shifts a +- ib occupies two consecutive steps
+    // v_{k+1} = (A - a) v_k and v_{k+2} = (A - a) v_{k+1} + b^2 v_k, such that
+    // the basis can be computed in real arithmetic, see Hoemmen (2010),
+    // Section 7.3.
+    inline FullMatrix<double>
+    compute_newton_basis(const FullMatrix<double> &hessenberg_matrix,
+                         const unsigned int        n,
+                         const unsigned int        s)
+    {
+      Assert(n >= s, ExcInternalError());
+
+      LAPACKFullMatrix<double> mat(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          mat(i, j) = hessenberg_matrix(i, j);
+      mat.compute_eigenvalues();
+
+      // keep only one member of each complex conjugate pair
+      std::vector<std::complex<double>> ritz_values;
+      for (unsigned int i = 0; i < n; ++i)
+        if (mat.eigenvalue(i).imag() >= 0.)
+          ritz_values.push_back(mat.eigenvalue(i));
+
+      std::vector<std::complex<double>> shifts;
+      std::vector<bool>                 selected(ritz_values.size(), false);
+      while (shifts.size() < s)
+        {
+          // pick the Ritz value with the largest modulus first, and then the
+          // one maximizing the product of the distances to the shifts
+          // selected so far, computed as a sum of logarithms to avoid
+          // overflow
+          unsigned int best       = numbers::invalid_unsigned_int;
+          double       best_value = std::numeric_limits<double>::lowest();
+          for (unsigned int i = 0; i < ritz_values.size(); ++i)
+            if (selected[i] == false)
+              {
+                double value = 0.;
+                if (shifts.empty())
+                  value = std::abs(ritz_values[i]);
+                else
+                  for (const auto &shift : shifts)
+                    value += std::log(std::abs(ritz_values[i] - shift));
+                if (best == numbers::invalid_unsigned_int || value > best_value)
+                  {
+                    best       = i;
+                    best_value = value;
+                  }
+              }
+          AssertThrow(best != numbers::invalid_unsigned_int,
+                      ExcInternalError());
+          selected[best] = true;
+
+          const std::complex<double> value = ritz_values[best];
+          if (value.imag() == 0.)
+            shifts.push_back(value);
+          else if (shifts.size() + 2 <= s)
+            {
+              shifts.push_back(value);
+              shifts.push_back(std::conj(value));
+            }
+          else
+            shifts.emplace_back(value.real(), 0.);
+        }
+
+      FullMatrix<double> change_of_basis(s + 1, s);
+      for (unsigned int k = 0; k < s; ++k)
+        {
+          change_of_basis(k, k)     = shifts[k].real();
+          change_of_basis(k + 1, k) = 1.;
+          if (shifts[k].imag() > 0.)
+            {
+              change_of_basis(k + 1, k + 1) = shifts[k].real();
+              change_of_basis(k + 2, k + 1) = 1.;
+              change_of_basis(k, k + 1) = -shifts[k].imag() * shifts[k].imag();
+              ++k;
+            }
+        }
+      return change_of_basis;
+    }
   } // namespace SolverGMRESImplementation
 } // namespace internal
 
@@ -1879,6 +2272,17 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
                              basis_size,
                              additional_data.force_re_orthogonalization);
 
+  // For the s-step variant, the change-of-basis matrix of the Newton basis
+  // gets computed from the Ritz values at the end of the first restart
+  // cycle, which uses the standard Arnoldi process
+  const unsigned int s_step_size =
+    std::min(additional_data.s_step_size, basis_size);
+  Assert(s_step_size == 1 || use_default_residual,
+         ExcMessage("The s-step variant of SolverGMRES is only available "
+                    "with the default residual."));
+  FullMatrix<double> change_of_basis;
+  bool               use_s_step = false;
+
   ///////////////////////////////////////////////////////////////////////////
   // outer iteration: loop until we either reach convergence or the maximum
   // number of iterations is exceeded. each cycle of this loop amounts to one
@@ -1887,6 +2291,14 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
     {
       VectorType &v = basis_vectors(0, x);
 
+      // the block orthogonalization of the s-step variant replaces the
+      // strategy selected for the standard Arnoldi process
+      if (use_s_step)
+        arnoldi_process.initialize(
+          LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt,
+          basis_size,
+          additional_data.force_re_orthogonalization);
+
       // Compute the preconditioned/unpreconditioned residual for left/right
       // preconditioning. If 'x' is the zero vector, then we can bypass the
       // full computation. But 'x' is only likely to be the zero vector if
@@ -1960,7 +2372,69 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       // inner iteration doing at most as many steps as the size of the
       // Arnoldi basis
       unsigned int inner_iteration = 0;
-      for (; (inner_iteration < basis_size &&
+
+      // in the s-step variant, generate s vectors of a Newton basis at once
+      // and orthonormalize them together
+      while (use_s_step && inner_iteration < basis_size &&
+             iteration_state == SolverControl::iterate)
+        {
+          const unsigned int s =
+            std::min(s_step_size, basis_size - inner_iteration);
+          for (unsigned int k = 0; k < s; ++k)
+            {
+              const unsigned int j  = inner_iteration + k;
+              VectorType        &vv = basis_vectors(j + 1, x);
+              if (left_precondition)
+                {
+                  A.vmult(p, basis_vectors[j]);
+                  preconditioner.vmult(vv, p);
+                }
+              else
+                {
+                  preconditioner.vmult(p, basis_vectors[j]);
+                  A.vmult(vv, p);
+                }
+              vv.add(-change_of_basis(k, k), basis_vectors[j]);
+              if (k > 0 && change_of_basis(k - 1, k) != 0.)
+                vv.add(-change_of_basis(k - 1, k), basis_vectors[j - 1]);
+            }
+
+          const double residual_estimate =
+            arnoldi_process.orthonormalize_block(inner_iteration,
+                                                 s,
+                                                 basis_vectors,
+                                                 change_of_basis);
+
+          // in case of a breakdown, end the current cycle with the vectors
+          // obtained so far, or, if no progress could be made at all, fall
+          // back to the standard Arnoldi process, which then continues the
+          // current cycle from the first basis vector below
+          if (residual_estimate < 0.)
+            {
+              if (inner_iteration == 0)
+                {
+                  use_s_step = false;
+                  arnoldi_process.initialize(
+                    additional_data.orthogonalization_strategy,
+                    basis_size,
+                    additional_data.force_re_orthogonalization);
+                }
+              break;
+            }
+
+          inner_iteration += s;
+          accumulated_iterations += s;
+          res = residual_estimate;
+          if (!additional_data.batched_mode)
+            s_step_block_signal(s);
+          if (additional_data.batched_mode)
+            iteration_state = solver_control.check(accumulated_iterations, res);
+          else
+            iteration_state =
+              this->iteration_status(accumulated_iterations, res, x);
+        }
+
+      for (; (use_s_step == false && inner_iteration < basis_size &&
               iteration_state == SolverControl::iterate);
            ++inner_iteration)
         {
@@ -2044,6 +2518,19 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       const Vector<double> &projected_solution =
         arnoldi_process.solve_projected_system(true);
 
+      // set up the s-step variant for the following cycles from the Ritz
+      // values of the first cycle that has enough of them
+      if (s_step_size > 1 && change_of_basis.m() == 0 &&
+          inner_iteration >= s_step_size &&
+          iteration_state == SolverControl::iterate)
+        {
+          change_of_basis = internal::SolverGMRESImplementation::
+            compute_newton_basis(arnoldi_process.get_hessenberg_matrix(),
+                                 inner_iteration,
+                                 s_step_size);
+          use_s_step = true;
+        }
+
       if (do_eigenvalues)
         compute_eigs_and_cond(arnoldi_process.get_hessenberg_matrix(),
                               inner_iteration,
@@ -2175,6 +2662,17 @@ boost::signals2::connection
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+boost::signals2::connection
+  SolverGMRES<VectorType>::connect_s_step_block_slot(
+    const std::function<void(unsigned int)> &slot)
+{
+  return s_step_block_signal.connect(slot);
+}
+
+
+
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 double SolverGMRES<VectorType>::criterion()
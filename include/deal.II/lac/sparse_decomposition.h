@@ -15,6 +15,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -92,6 +95,24 @@ DEAL_II_NAMESPACE_OPEN
  * restrictions on the sparsity see section `Fill-in' above).
  *
  *
+ * <h3>Parallelization</h3>
+ *
+ * The triangular sweeps of the factorization and of the application of
+ * the decomposition are inherently sequential if the rows are processed in
+ * their natural order. If more than one thread is available (see
+ * MultithreadInfo), the derived classes instead process the rows by levels:
+ * all rows in one level only depend on rows of earlier levels, so the rows
+ * of a level are distributed among the threads. Each row is still computed
+ * with exactly the same operations in the same order as in the sequential
+ * algorithm, so the results do not depend on the number of threads.
+ *
+ * The number of levels is given by the longest chain of dependencies in the
+ * sparsity pattern, which depends on the numbering of the unknowns. For the
+ * lexicographic numbering on a structured mesh, the levels are the diagonal
+ * wavefronts through the mesh. Levels with fewer rows than a minimal grain
+ * size are processed by a single thread.
+ *
+ *
  * <h3>Particular implementations</h3>
  *
  * It is enough to override the initialize() and vmult() methods to implement
@@ -321,6 +342,58 @@ protected:
   void
   prebuild_lower_bound();
 
+  /**
+   * A grouping of the rows of the decomposition into levels for a
+   * triangular sweep. The rows of a level only depend on rows of earlier
+   * levels and can be processed in any order, in particular in parallel.
+   * The rows of level <code>l</code> are stored in ascending order in the
+   * range <code>[rows[level_starts[l]], rows[level_starts[l+1]])</code>.
+   */
+  struct LevelSchedule
+  {
+    std::vector<size_type> rows;
+    std::vector<size_type> level_starts;
+  };
+
+  /**
+   * The level schedule of a forward sweep over the strictly lower
+   * triangular part of the decomposition, in which row <code>i</code>
+   * depends on all rows <code>j&lt;i</code> with an entry in column
+   * <code>j</code> of row <code>i</code>. Becomes available after invocation
+   * of prebuild_level_schedules().
+   */
+  LevelSchedule lower_level_schedule;
+
+  /**
+   * The level schedule of a backward sweep over the strictly upper
+   * triangular part of the decomposition, in which row <code>i</code>
+   * depends on all rows <code>j&gt;i</code> with an entry in column
+   * <code>j</code> of row <code>i</code>. Becomes available after invocation
+   * of prebuild_level_schedules().
+   */
+  LevelSchedule upper_level_schedule;
+
+  /**
+   * Fills #lower_level_schedule and #upper_level_schedule. Requires that
+   * prebuild_lower_bound() has been called before.
+   */
+  void
+  prebuild_level_schedules();
+
+  /**
+   * Call @p row_operation for every row of the matrix, in an order that
+   * respects the dependencies described by @p schedule. With a single
+   * thread, the rows are visited in their natural order, ascending or,
+   * if @p backward is set, descending. Otherwise, the levels of
+   * @p schedule are processed one after the other and the rows within
+   * each level in parallel.
+   */
+  template <typename RowOperation>
+  void
+  apply_level_scheduled(const LevelSchedule &schedule,
+                        const bool           backward,
+                        const RowOperation  &row_operation) const;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -405,6 +478,44 @@ SparseLUDecomposition<number>::Tvmult_add(OutVector      &dst,
   dst += tmp;
 }
 
+
+template <typename number>
+template <typename RowOperation>
+inline void
+SparseLUDecomposition<number>::apply_level_scheduled(
+  const LevelSchedule &schedule,
+  const bool           backward,
+  const RowOperation  &row_operation) const
+{
+  const size_type N = this->m();
+  Assert(schedule.level_starts.size() > 0 || N == 0, ExcNotInitialized());
+
+  // on a single thread or if there is no parallelism to exploit, the
+  // natural order of rows is a valid schedule with better data locality
+  if (MultithreadInfo::n_threads() == 1 ||
+      schedule.level_starts.size() == N + 1)
+    {
+      if (backward)
+        for (size_type row = N; row > 0;)
+          row_operation(--row);
+      else
+        for (size_type row = 0; row < N; ++row)
+          row_operation(row);
+      return;
+    }
+
+  for (unsigned int level = 0; level + 1 < schedule.level_starts.size();
+       ++level)
+    parallel::apply_to_subranges(
+      schedule.rows.data() + schedule.level_starts[level],
+      schedule.rows.data() + schedule.level_starts[level + 1],
+      [&row_operation](const size_type *begin, const size_type *end) {
+        for (const size_type *row = begin; row != end; ++row)
+          row_operation(*row);
+      },
+      internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
 //---------------------------------------------------------------------------
 
 
@@ -53,6 +53,8 @@ SparseLUDecomposition<number>::clear()
 {
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
+  lower_level_schedule = LevelSchedule();
+  upper_level_schedule = LevelSchedule();
 
   SparseMatrix<number>::clear();
 
@@ -130,6 +132,8 @@ SparseLUDecomposition<number>::initialize(
     std::vector<const size_type *> tmp;
     tmp.swap(prebuilt_lower_bound);
   }
+  lower_level_schedule = LevelSchedule();
+  upper_level_schedule = LevelSchedule();
   SparseMatrix<number>::reinit(*sparsity_pattern_to_use);
 }
 
@@ -156,6 +160,65 @@ SparseLUDecomposition<number>::prebuild_lower_bound()
     }
 }
 
+
+
+template <typename number>
+void
+SparseLUDecomposition<number>::prebuild_level_schedules()
+{
+  const size_type *const column_numbers =
+    this->get_sparsity_pattern().colnums.get();
+  const std::size_t *const rowstart_indices =
+    this->get_sparsity_pattern().rowstart.get();
+  const size_type N = this->m();
+
+  AssertDimension(prebuilt_lower_bound.size(), N);
+
+  // sort the rows by level with a counting sort, which keeps the rows of
+  // each level in ascending order
+  const auto sort_by_level = [N](const std::vector<unsigned int> &row_levels,
+                                 LevelSchedule                   &schedule) {
+    const unsigned int n_levels =
+      (N > 0) ? *std::max_element(row_levels.begin(), row_levels.end()) + 1 :
+                0;
+    schedule.level_starts.assign(n_levels + 1, 0);
+    for (size_type row = 0; row < N; ++row)
+      ++schedule.level_starts[row_levels[row] + 1];
+    for (unsigned int level = 0; level < n_levels; ++level)
+      schedule.level_starts[level + 1] += schedule.level_starts[level];
+
+    std::vector<size_type> next_position(schedule.level_starts.begin(),
+                                         schedule.level_starts.end() - 1);
+    schedule.rows.resize(N);
+    for (size_type row = 0; row < N; ++row)
+      schedule.rows[next_position[row_levels[row]]++] = row;
+  };
+
+  std::vector<unsigned int> row_levels(N, 0);
+
+  // the level of a row in the forward sweep is one more than the largest
+  // level of the rows it depends on, i.e., of the columns left of the
+  // diagonal
+  for (size_type row = 0; row < N; ++row)
+    for (const size_type *col = &column_numbers[rowstart_indices[row] + 1];
+         col != prebuilt_lower_bound[row];
+         ++col)
+      row_levels[row] = std::max(row_levels[row], row_levels[*col] + 1);
+  sort_by_level(row_levels, lower_level_schedule);
+
+  // same for the backward sweep with the columns right of the diagonal
+  std::fill(row_levels.begin(), row_levels.end(), 0);
+  for (size_type row = N; row > 0;)
+    {
+      --row;
+      for (const size_type *col = prebuilt_lower_bound[row];
+           col != &column_numbers[rowstart_indices[row + 1]];
+           ++col)
+        row_levels[row] = std::max(row_levels[row], row_levels[*col] + 1);
+    }
+  sort_by_level(row_levels, upper_level_schedule);
+}
+
 template <typename number>
 template <typename somenumber>
 void
@@ -235,8 +298,13 @@ template <typename number>
 std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
-  return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+  return (
+    SparseMatrix<number>::memory_consumption() +
+    MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+    MemoryConsumption::memory_consumption(lower_level_schedule.rows) +
+    MemoryConsumption::memory_consumption(lower_level_schedule.level_starts) +
+    MemoryConsumption::memory_consumption(upper_level_schedule.rows) +
+    MemoryConsumption::memory_consumption(upper_level_schedule.level_starts));
 }
 
 
@@ -44,6 +44,7 @@ SparseILU<number>::initialize(const SparseMatrix<somenumber> &matrix,
 
   this->strengthen_diagonal = data.strengthen_diagonal;
   this->prebuild_lower_bound();
+  this->prebuild_level_schedules();
   this->copy_from(matrix);
 
   if (data.strengthen_diagonal > 0)
@@ -58,74 +59,58 @@ SparseILU<number>::initialize(const SparseMatrix<somenumber> &matrix,
 
   number *luval = this->SparseMatrix<number>::val.get();
 
-  const size_type N    = this->m();
-  size_type       jrow = 0;
-
-  std::vector<size_type> iw(N, numbers::invalid_size_type);
-
-  for (size_type k = 0; k < N; ++k)
-    {
-      const size_type j1 = ia[k], j2 = ia[k + 1] - 1;
-
-      for (size_type j = j1; j <= j2; ++j)
-        iw[ja[j]] = j;
-
-      // the algorithm in the book works on the elements of row k left of the
-      // diagonal. however, since we store the diagonal element at the first
-      // position, start at the element after the diagonal and run as long as
-      // we don't walk into the right half
-      size_type j = j1 + 1;
-
-      // pathological case: the current row of the matrix has only the
-      // diagonal entry. then we have nothing to do.
-      if (j > j2)
-        goto label_200;
-
-    label_150:
-
-      jrow = ja[j];
-      if (jrow >= k)
-        goto label_200;
-
-      // actual computations:
+  // row k only reads from the rows jrow<k it has entries in and writes into
+  // row k alone, so the rows can be factorized in the order of the level
+  // schedule of the forward sweep
+  const auto factorize_row = [&](const size_type k) {
+    const size_type j1 = ia[k], j2 = ia[k + 1];
+
+    // the algorithm in the book works on the elements of row k left of the
+    // diagonal. however, since we store the diagonal element at the first
+    // position, start at the element after the diagonal and run as long as
+    // we don't walk into the right half
+    const size_type j_end = this->prebuilt_lower_bound[k] - ja;
+    for (size_type j = j1 + 1; j < j_end; ++j)
       {
-        number t1 = luval[j] * luval[ia[jrow]];
-        luval[j]  = t1;
+        const size_type jrow = ja[j];
+
+        const number t1 = luval[j] * luval[ia[jrow]];
+        luval[j]        = t1;
 
         // jj runs from just right of the diagonal to the end of the row
-        size_type jj = ia[jrow] + 1;
-        while (ja[jj] < jrow)
-          ++jj;
-        for (; jj < ia[jrow + 1]; ++jj)
+        // jrow. instead of the scatter array of the book, which would need
+        // to be duplicated for each thread, find the entries of row k in
+        // the same column by a merge of the two sorted column lists. the
+        // diagonal entry of row k is stored first and needs special care
+        size_type jw = j1 + 1;
+        for (size_type jj = this->prebuilt_lower_bound[jrow] - ja;
+             jj < ia[jrow + 1];
+             ++jj)
           {
-            const size_type jw = iw[ja[jj]];
-            if (jw != numbers::invalid_size_type)
-              luval[jw] -= t1 * luval[jj];
+            const size_type column = ja[jj];
+            if (column == k)
+              luval[j1] -= t1 * luval[jj];
+            else
+              {
+                while (jw < j2 && ja[jw] < column)
+                  ++jw;
+                if (jw < j2 && ja[jw] == column)
+                  luval[jw] -= t1 * luval[jj];
+              }
           }
-
-        ++j;
-        if (j <= j2)
-          goto label_150;
       }
 
-    label_200:
+    // now we have to deal with the diagonal element. in the book it is
+    // located at position 'j', but here we use the convention of storing
+    // the diagonal element first, so instead of j we use uptr[k]=ia[k]
+    Assert(luval[ia[k]] != 0, ExcZeroPivot(k));
 
-      // in the book there is an assertion that we have hit the diagonal
-      // element, i.e. that jrow==k. however, we store the diagonal element at
-      // the front, so jrow must actually be larger than k or j is already in
-      // the next row
-      Assert((jrow > k) || (j == ia[k + 1]), ExcInternalError());
+    luval[ia[k]] = 1. / luval[ia[k]];
+  };
 
-      // now we have to deal with the diagonal element. in the book it is
-      // located at position 'j', but here we use the convention of storing
-      // the diagonal element first, so instead of j we use uptr[k]=ia[k]
-      Assert(luval[ia[k]] != 0, ExcZeroPivot(k));
-
-      luval[ia[k]] = 1. / luval[ia[k]];
-
-      for (size_type j = j1; j <= j2; ++j)
-        iw[ja[j]] = numbers::invalid_size_type;
-    }
+  this->apply_level_scheduled(this->lower_level_schedule,
+                              false,
+                              factorize_row);
 }
 
 
@@ -140,7 +125,6 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
          ExcDimensionMismatch(dst.size(), src.size()));
   Assert(dst.size() == this->m(), ExcDimensionMismatch(dst.size(), this->m()));
 
-  const size_type          N = dst.size();
   const std::size_t *const rowstart_indices =
     this->get_sparsity_pattern().rowstart.get();
   const size_type *const column_numbers =
@@ -158,9 +142,12 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // we split the y_i = b_i off and
   // perform it at the outset of the
   // loop
+  //
+  // both sweeps are applied in the order of the respective level schedule,
+  // which gives the same result as the natural order
   dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
+  this->apply_level_scheduled(
+    this->lower_level_schedule, false, [&](const size_type row) {
       // get start of this row. skip the
       // diagonal element
       const size_type *const rowstart =
@@ -177,7 +164,7 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
            ++col, ++luval)
         dst_row -= *luval * dst(*col);
       dst(row) = dst_row;
-    }
+    });
 
   // now the backward solve. same
   // procedure, but we need not set
@@ -187,8 +174,8 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // note that we need to scale now,
   // since the diagonal is not equal to
   // one now
-  for (int row = N - 1; row >= 0; --row)
-    {
+  this->apply_level_scheduled(
+    this->upper_level_schedule, true, [&](const size_type row) {
       // get end of this row
       const size_type *const rowend =
         &column_numbers[rowstart_indices[row + 1]];
@@ -208,7 +195,7 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
       // note that the diagonal element
       // was stored inverted
       dst(row) = dst_row * this->diag_element(row);
-    }
+    });
 }
 
 
@@ -30,6 +30,7 @@
 #include <boost/io/ios_state.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <iomanip>
@@ -487,6 +488,43 @@ namespace internal
             *dst_ptr++ = s;
           }
     }
+
+
+    /**
+     * Perform a vmult on several vectors at once, using the CSR matrix data
+     * of the rows in <tt>[begin_row, end_row)</tt>. The vectors are processed
+     * in groups of at most eight for each row, such that the row data is
+     * read from memory only once and the partial sums stay in registers.
+     */
+    template <typename number, typename somenumber>
+    void
+    vmult_multiple_on_subrange(const size_type          begin_row,
+                               const size_type          end_row,
+                               const number            *values,
+                               const std::size_t       *rowstart,
+                               const size_type         *colnums,
+                               const somenumber *const *src,
+                               somenumber *const       *dst,
+                               const unsigned int       n_vectors)
+    {
+      constexpr unsigned int group_size = 8;
+      for (size_type row = begin_row; row < end_row; ++row)
+        for (unsigned int k0 = 0; k0 < n_vectors; k0 += group_size)
+          {
+            const unsigned int n_in_group =
+              std::min(group_size, n_vectors - k0);
+            std::array<somenumber, group_size> sums = {};
+            for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+              {
+                const somenumber value  = somenumber(values[j]);
+                const size_type  column = colnums[j];
+                for (unsigned int k = 0; k < n_in_group; ++k)
+                  sums[k] += value * src[k0 + k][column];
+              }
+            for (unsigned int k = 0; k < n_in_group; ++k)
+              dst[k0 + k][row] = sums[k];
+          }
+    }
   } // namespace SparseMatrixImplementation
 } // namespace internal
 
@@ -767,6 +805,102 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
 
 
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrix<number>::vmult_multiple(std::vector<VectorType>       &dst,
+                                     const std::vector<VectorType> &src) const
+{
+  using somenumber = typename VectorType::value_type;
+
+  Assert(val != nullptr, ExcNotInitialized());
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+
+  const unsigned int n_vectors = src.size();
+  AssertDimension(dst.size(), n_vectors);
+
+  std::vector<const somenumber *> src_ptrs(n_vectors);
+  std::vector<somenumber *>       dst_ptrs(n_vectors);
+  for (unsigned int k = 0; k < n_vectors; ++k)
+    {
+      Assert(m() == dst[k].size(), ExcDimensionMismatch(m(), dst[k].size()));
+      Assert(n() == src[k].size(), ExcDimensionMismatch(n(), src[k].size()));
+      Assert(!PointerComparison::equal(&src[k], &dst[k]),
+             ExcSourceEqualsDestination());
+      src_ptrs[k] = src[k].begin();
+      dst_ptrs[k] = dst[k].begin();
+    }
+
+  if (n_vectors == 0)
+    return;
+
+  parallel::apply_to_subranges(
+    0U,
+    cols->n_rows(),
+    [this, &src_ptrs, &dst_ptrs, n_vectors](const size_type begin_row,
+                                            const size_type end_row) {
+      internal::SparseMatrixImplementation::vmult_multiple_on_subrange(
+        begin_row,
+        end_row,
+        val.get(),
+        cols->rowstart.get(),
+        cols->colnums.get(),
+        src_ptrs.data(),
+        dst_ptrs.data(),
+        n_vectors);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrix<number>::vmult_overlapped(VectorType       &dst,
+                                       const VectorType &src) const
+{
+  using somenumber = typename VectorType::value_type;
+
+  Assert(val != nullptr, ExcNotInitialized());
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(m() == dst.locally_owned_size(),
+         ExcDimensionMismatch(m(), dst.locally_owned_size()));
+  Assert(n() == src.locally_owned_size() +
+                  src.get_partitioner()->n_ghost_indices(),
+         ExcDimensionMismatch(n(),
+                              src.locally_owned_size() +
+                                src.get_partitioner()->n_ghost_indices()));
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const number      *values   = val.get();
+  const std::size_t *rowstart = cols->rowstart.get();
+  const size_type   *colnums  = cols->colnums.get();
+  const somenumber  *src_ptr  = src.begin();
+  somenumber        *dst_ptr  = dst.begin();
+
+  const auto compute_rows = [&](const unsigned int begin,
+                                const unsigned int end) {
+    parallel::apply_to_subranges(
+      begin,
+      end,
+      [&](const unsigned int begin_row, const unsigned int end_row) {
+        for (unsigned int row = begin_row; row < end_row; ++row)
+          {
+            somenumber s = 0.;
+            for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+              s += somenumber(values[j]) * src_ptr[colnums[j]];
+            dst_ptr[row] = s;
+          }
+      },
+      internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+  };
+
+  src.update_ghost_values_overlapped(compute_rows, compute_rows);
+}
+
+
+
 template <typename number>
 template <class OutVector, class InVector>
 void
@@ -67,6 +67,7 @@ SparseMIC<number>::initialize(const SparseMatrix<somenumber> &matrix,
   SparseLUDecomposition<number>::initialize(matrix, data);
   this->strengthen_diagonal = data.strengthen_diagonal;
   this->prebuild_lower_bound();
+  this->prebuild_level_schedules();
   this->copy_from(matrix);
 
   Assert(this->m() == this->n(), ExcNotQuadratic());
@@ -89,27 +90,43 @@ SparseMIC<number>::initialize(const SparseMatrix<somenumber> &matrix,
   inner_sums.resize(this->m());
 
   // precalc sum(j=k+1, N, a[k][j]))
-  for (size_type row = 0; row < this->m(); ++row)
-    inner_sums[row] = get_rowsum(row);
-
-  for (size_type row = 0; row < this->m(); ++row)
-    {
-      const number temp  = this->begin(row)->value();
-      number       temp1 = 0;
-
-      // work on the lower left part of the matrix. we know
-      // it's symmetric, so we can work with this alone
-      for (typename SparseMatrix<somenumber>::const_iterator p =
-             matrix.begin(row) + 1;
-           (p != matrix.end(row)) && (p->column() < row);
-           ++p)
-        temp1 += p->value() / diag[p->column()] * inner_sums[p->column()];
-
-      Assert(temp - temp1 > 0, ExcStrengthenDiagonalTooSmall());
-      diag[row] = temp - temp1;
-
-      inv_diag[row] = 1.0 / diag[row];
-    }
+  parallel::apply_to_subranges(
+    size_type(0),
+    this->m(),
+    [this](const size_type begin, const size_type end) {
+      for (size_type row = begin; row < end; ++row)
+        inner_sums[row] = get_rowsum(row);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  const auto compute_diagonal = [&](const size_type row) {
+    const number temp  = this->begin(row)->value();
+    number       temp1 = 0;
+
+    // work on the lower left part of the matrix. we know
+    // it's symmetric, so we can work with this alone
+    for (typename SparseMatrix<somenumber>::const_iterator p =
+           matrix.begin(row) + 1;
+         (p != matrix.end(row)) && (p->column() < row);
+         ++p)
+      temp1 += p->value() / diag[p->column()] * inner_sums[p->column()];
+
+    Assert(temp - temp1 > 0, ExcStrengthenDiagonalTooSmall());
+    diag[row] = temp - temp1;
+
+    inv_diag[row] = 1.0 / diag[row];
+  };
+
+  // the level schedule describes the dependencies through the sparsity
+  // pattern of the decomposition, which is only guaranteed to contain the
+  // one of the matrix if the two are the same
+  if (&matrix.get_sparsity_pattern() == &this->get_sparsity_pattern())
+    this->apply_level_scheduled(this->lower_level_schedule,
+                                false,
+                                compute_diagonal);
+  else
+    for (size_type row = 0; row < this->m(); ++row)
+      compute_diagonal(row);
 }
 
 
@@ -147,9 +164,12 @@ SparseMIC<number>::vmult(Vector<somenumber>       &dst,
   // strictly lower- and upper- diagonal parts of the system.
   //
   // Solve (X-L)X{-1}(X-U) x = b in 3 steps:
+  //
+  // The two triangular sweeps are applied in the order of the respective
+  // level schedule, which gives the same result as the natural order.
   dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
+  this->apply_level_scheduled(
+    this->lower_level_schedule, false, [&](const size_type row) {
       // Now: (X-L)u = b
 
       // get start of this row. skip
@@ -161,25 +181,25 @@ SparseMIC<number>::vmult(Vector<somenumber>       &dst,
         dst(row) -= p->value() * dst(p->column());
 
       dst(row) *= inv_diag[row];
-    }
+    });
 
   // Now: v = Xu
   for (size_type row = 0; row < N; ++row)
     dst(row) *= diag[row];
 
   // x = (X-U)v
-  for (int row = N - 1; row >= 0; --row)
-    {
+  this->apply_level_scheduled(
+    this->upper_level_schedule, true, [&](const size_type row) {
       // get end of this row
       for (typename SparseMatrix<number>::const_iterator p =
              this->begin(row) + 1;
            p != this->end(row);
            ++p)
-        if (p->column() > static_cast<size_type>(row))
+        if (p->column() > row)
           dst(row) -= p->value() * dst(p->column());
 
       dst(row) *= inv_diag[row];
-    }
+    });
 }
 
 
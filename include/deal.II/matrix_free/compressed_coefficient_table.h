@@ -0,0 +1,616 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_compressed_coefficient_table_h
+#define dealii_matrix_free_compressed_coefficient_table_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A compressed storage for a coefficient given at the quadrature points of
+ * the cell batches of a MatrixFree object, as an alternative to storing all
+ * quadrature-point values in a Table<2, VectorizedArray<Number>> as done
+ * e.g. in step-37. For each cell batch, the values are projected onto
+ * polynomials of increasing degree $p = 0, 1, \ldots$ (in each coordinate
+ * direction of the reference cell) up to AdditionalData::max_degree, and
+ * the first degree that reproduces the values up to
+ * AdditionalData::tolerance is selected. For that degree, only the
+ * $(p+1)^d$ expansion coefficients are stored, i.e., one value for
+ * cell-wise constant coefficients and $2^d$ values for coefficients that
+ * are (multi-)linear on the cells, compared to $n_q^d$ values at the
+ * quadrature points. Cell batches where no such degree exists store the
+ * values at the quadrature points.
+ *
+ * The values at the quadrature points are computed on the fly by
+ * get_values() with sum factorization, at a cost of roughly
+ * $d (p+1) n_q^d$ operations per cell batch, which is small compared to
+ * the evaluation of a finite element function on the cell. The typical use
+ * within the quadrature-point loop of FEEvaluation is
+ * @code
+ * CompressedCoefficientTable<dim, double> coefficient;
+ * coefficient.initialize(matrix_free, coefficient_function);
+ * ...
+ * AlignedVector<VectorizedArray<double>> scratch;
+ * for (unsigned int cell = range.first; cell < range.second; ++cell)
+ *   {
+ *     phi.reinit(cell);
+ *     phi.gather_evaluate(src, EvaluationFlags::gradients);
+ *     const ArrayView<const VectorizedArray<double>> coefficient_values =
+ *       coefficient.get_values(cell, scratch);
+ *     for (const unsigned int q : phi.quadrature_point_indices())
+ *       phi.submit_gradient(coefficient_values[q] * phi.get_gradient(q), q);
+ *     phi.integrate_scatter(EvaluationFlags::gradients, dst);
+ *   }
+ * @endcode
+ *
+ * @note This class requires a tensor-product quadrature formula and the
+ * same quadrature formula on all cells, i.e., it does not support hp
+ * setups with several quadrature formulas or simplex cells.
+ */
+template <int dim,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class CompressedCoefficientTable
+{
+public:
+  /**
+   * Parameters of the compression.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int max_degree        = 2,
+                   const double       tolerance         = 1e-12,
+                   const unsigned int quadrature_index  = 0,
+                   const unsigned int dof_handler_index = 0)
+      : max_degree(max_degree)
+      , tolerance(tolerance)
+      , quadrature_index(quadrature_index)
+      , dof_handler_index(dof_handler_index)
+    {}
+
+    /**
+     * The maximal polynomial degree used for the compression. Degrees of
+     * one less than the number of 1d quadrature points and above are not
+     * considered, as they do not save memory.
+     */
+    unsigned int max_degree;
+
+    /**
+     * The tolerance for the compressed representation, relative to the
+     * largest absolute value of the coefficient on the cell batch.
+     */
+    double tolerance;
+
+    /**
+     * Index of the quadrature formula within MatrixFree the values
+     * correspond to.
+     */
+    unsigned int quadrature_index;
+
+    /**
+     * Index of the DoFHandler within MatrixFree used to set up an
+     * FEEvaluation object for the evaluation of the quadrature points in
+     * the initialize() function taking a Function object.
+     */
+    unsigned int dof_handler_index;
+  };
+
+  /**
+   * Compress the values of a coefficient given at all quadrature points
+   * of all cell batches, with the cell batch index as the first and the
+   * quadrature point index as the second index of @p values.
+   */
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const Table<2, VectorizedArrayType>                &values,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Evaluate @p function at the quadrature points of all cell batches and
+   * compress the values. This function does not build the full table of
+   * values. The MatrixFree object needs to be set up with
+   * update_quadrature_points.
+   */
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const Function<dim, Number>                        &function,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Return the values of the coefficient at the quadrature points of the
+   * given cell batch. The array @p scratch_data is used to store the
+   * values for compressed cell batches and is resized as needed, so that
+   * the returned array is valid as long as @p scratch_data is not changed.
+   */
+  ArrayView<const VectorizedArrayType>
+  get_values(const unsigned int                  cell_batch_index,
+             AlignedVector<VectorizedArrayType> &scratch_data) const;
+
+  /**
+   * Return the polynomial degree used for the given cell batch, or
+   * numbers::invalid_unsigned_int if the values at the quadrature points
+   * are stored.
+   */
+  unsigned int
+  get_degree(const unsigned int cell_batch_index) const;
+
+  /**
+   * Return the number of quadrature points per cell batch.
+   */
+  unsigned int
+  n_q_points() const;
+
+  /**
+   * Return the memory consumption of this class in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Set up the projection and evaluation matrices for all degrees.
+   */
+  void
+  initialize_shape_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free);
+
+  /**
+   * Find the compressed representation of @p values on one cell batch and
+   * append it to the stored data.
+   */
+  void
+  compress_cell_batch(const unsigned int         cell_batch_index,
+                      const VectorizedArrayType *values,
+                      VectorizedArrayType       *scratch_data);
+
+  /**
+   * Evaluate the expansion of degree @p degree given by @p coefficients at
+   * the quadrature points. The array @p tmp needs space for n_q_points()
+   * entries.
+   */
+  void
+  evaluate(const unsigned int         degree,
+           const VectorizedArrayType *coefficients,
+           VectorizedArrayType       *values,
+           VectorizedArrayType       *tmp) const;
+
+  /**
+   * The parameters passed to initialize().
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The number of 1d quadrature points.
+   */
+  unsigned int n_q_points_1d = 0;
+
+  /**
+   * For each degree $p$, the values of the orthonormal Legendre
+   * polynomials up to degree $p$ at the 1d quadrature points, stored as a
+   * $(p+1) \times n_q$ matrix.
+   */
+  std::vector<AlignedVector<Number>> evaluation_matrices;
+
+  /**
+   * For each degree $p$, the $(p+1) \times n_q$ matrix of the discrete
+   * $L_2$ projection from the values at the 1d quadrature points onto the
+   * Legendre polynomials up to degree $p$.
+   */
+  std::vector<AlignedVector<Number>> projection_matrices;
+
+  /**
+   * The degree of each cell batch, see get_degree().
+   */
+  std::vector<unsigned int> degrees;
+
+  /**
+   * The offset of the data of each cell batch in the array data.
+   */
+  std::vector<unsigned int> data_offsets;
+
+  /**
+   * The expansion coefficients or values at the quadrature points of all
+   * cell batches.
+   */
+  AlignedVector<VectorizedArrayType> data;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::
+  initialize_shape_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free)
+{
+  const auto &descriptors =
+    matrix_free.get_mapping_info()
+      .cell_data[additional_data.quadrature_index]
+      .descriptor;
+  AssertThrow(descriptors.size() == 1,
+              ExcMessage("CompressedCoefficientTable only supports a single "
+                         "quadrature formula on all cells."));
+  const Quadrature<1> &quadrature_1d = descriptors[0].quadrature_1d;
+  AssertThrow(quadrature_1d.size() > 0 &&
+                Utilities::fixed_power<dim>(quadrature_1d.size()) ==
+                  descriptors[0].n_q_points,
+              ExcMessage("CompressedCoefficientTable requires a "
+                         "tensor-product quadrature formula."));
+
+  n_q_points_1d = quadrature_1d.size();
+
+  // a degree of n_q_points_1d-1 would store as many values as the
+  // quadrature points
+  const unsigned int max_degree =
+    std::min(additional_data.max_degree,
+             n_q_points_1d > 1 ? n_q_points_1d - 2 : 0);
+  evaluation_matrices.resize(max_degree + 1);
+  projection_matrices.resize(max_degree + 1);
+  for (unsigned int degree = 0; degree <= max_degree; ++degree)
+    {
+      const unsigned int n_rows = degree + 1;
+      evaluation_matrices[degree].resize(n_rows * n_q_points_1d);
+      projection_matrices[degree].resize(n_rows * n_q_points_1d);
+
+      FullMatrix<double> values(n_rows, n_q_points_1d);
+      for (unsigned int i = 0; i < n_rows; ++i)
+        {
+          const Polynomials::Legendre legendre(i);
+          for (unsigned int q = 0; q < n_q_points_1d; ++q)
+            values(i, q) = legendre.value(quadrature_1d.point(q)[0]);
+        }
+
+      // the Legendre polynomials are orthonormal, but the quadrature
+      // formula might not integrate their products exactly, so invert the
+      // discrete Gram matrix
+      FullMatrix<double> gram(n_rows, n_rows);
+      for (unsigned int i = 0; i < n_rows; ++i)
+        for (unsigned int j = 0; j < n_rows; ++j)
+          for (unsigned int q = 0; q < n_q_points_1d; ++q)
+            gram(i, j) +=
+              values(i, q) * values(j, q) * quadrature_1d.weight(q);
+      gram.gauss_jordan();
+
+      for (unsigned int i = 0; i < n_rows; ++i)
+        for (unsigned int q = 0; q < n_q_points_1d; ++q)
+          {
+            evaluation_matrices[degree][i * n_q_points_1d + q] = values(i, q);
+            double projection = 0;
+            for (unsigned int j = 0; j < n_rows; ++j)
+              projection += gram(i, j) * values(j, q);
+            projection_matrices[degree][i * n_q_points_1d + q] =
+              projection * quadrature_1d.weight(q);
+          }
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const Table<2, VectorizedArrayType>                &values,
+  const AdditionalData                               &data)
+{
+  clear();
+  additional_data = data;
+  initialize_shape_data(matrix_free);
+
+  AssertDimension(values.size(0), matrix_free.n_cell_batches());
+  AssertDimension(values.size(1), n_q_points());
+
+  AlignedVector<VectorizedArrayType> scratch_data(2 * n_q_points());
+  degrees.reserve(matrix_free.n_cell_batches());
+  data_offsets.reserve(matrix_free.n_cell_batches() + 1);
+  data_offsets.push_back(0);
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    compress_cell_batch(cell, &values(cell, 0), scratch_data.data());
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const Function<dim, Number>                        &function,
+  const AdditionalData                               &data)
+{
+  clear();
+  additional_data = data;
+  initialize_shape_data(matrix_free);
+
+  FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+    matrix_free,
+    additional_data.dof_handler_index,
+    additional_data.quadrature_index);
+  AssertDimension(phi.n_q_points, n_q_points());
+
+  AlignedVector<VectorizedArrayType> values(n_q_points());
+  AlignedVector<VectorizedArrayType> scratch_data(2 * n_q_points());
+  degrees.reserve(matrix_free.n_cell_batches());
+  data_offsets.reserve(matrix_free.n_cell_batches() + 1);
+  data_offsets.push_back(0);
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi.reinit(cell);
+      const unsigned int n_lanes =
+        matrix_free.n_active_entries_per_cell_batch(cell);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          const Point<dim, VectorizedArrayType> point_batch =
+            phi.quadrature_point(q);
+          // fill the unused lanes with the value of the first lane to not
+          // disturb the compression
+          for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+            {
+              Point<dim, Number> point;
+              for (unsigned int d = 0; d < dim; ++d)
+                point[d] = point_batch[d][v < n_lanes ? v : 0];
+              values[q][v] = function.value(point);
+            }
+        }
+      compress_cell_batch(cell, values.data(), scratch_data.data());
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::clear()
+{
+  n_q_points_1d = 0;
+  evaluation_matrices.clear();
+  projection_matrices.clear();
+  degrees.clear();
+  data_offsets.clear();
+  data.clear();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::
+  compress_cell_batch(const unsigned int         cell_batch_index,
+                      const VectorizedArrayType *values,
+                      VectorizedArrayType       *scratch_data)
+{
+  AssertDimension(cell_batch_index, degrees.size());
+  (void)cell_batch_index;
+
+  const unsigned int n_points = n_q_points();
+
+  VectorizedArrayType max_value = VectorizedArrayType();
+  for (unsigned int q = 0; q < n_points; ++q)
+    max_value = std::max(max_value, std::abs(values[q]));
+  Number tolerance = 0;
+  for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+    tolerance = std::max(tolerance, max_value[v]);
+  tolerance *= additional_data.tolerance;
+
+  VectorizedArrayType *coefficients = scratch_data;
+  VectorizedArrayType *tmp          = scratch_data + n_points;
+  AlignedVector<VectorizedArrayType> approximation(n_points);
+
+  for (unsigned int degree = 0; degree < projection_matrices.size(); ++degree)
+    {
+      // project onto the polynomials of the given degree, starting from
+      // the last direction as in the integration of FEEvaluation
+      const unsigned int n_rows = degree + 1;
+      internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                       dim,
+                                       0,
+                                       0,
+                                       VectorizedArrayType,
+                                       Number>
+        eval(projection_matrices[degree],
+             AlignedVector<Number>(),
+             AlignedVector<Number>(),
+             n_rows,
+             n_q_points_1d);
+      if constexpr (dim == 1)
+        eval.template values<0, false, false>(values, coefficients);
+      else if constexpr (dim == 2)
+        {
+          eval.template values<1, false, false>(values, tmp);
+          eval.template values<0, false, false>(tmp, coefficients);
+        }
+      else if constexpr (dim == 3)
+        {
+          eval.template values<2, false, false>(values, coefficients);
+          eval.template values<1, false, false>(coefficients, tmp);
+          eval.template values<0, false, false>(tmp, coefficients);
+        }
+
+      evaluate(degree, coefficients, approximation.data(), tmp);
+
+      Number error = 0;
+      for (unsigned int q = 0; q < n_points; ++q)
+        {
+          const VectorizedArrayType difference =
+            std::abs(approximation[q] - values[q]);
+          for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+            error = std::max(error, difference[v]);
+        }
+
+      if (error <= tolerance)
+        {
+          const unsigned int n_coefficients =
+            Utilities::fixed_power<dim>(n_rows);
+          data.insert_back(coefficients, coefficients + n_coefficients);
+          degrees.push_back(degree);
+          data_offsets.push_back(data.size());
+          return;
+        }
+    }
+
+  data.insert_back(values, values + n_points);
+  degrees.push_back(numbers::invalid_unsigned_int);
+  data_offsets.push_back(data.size());
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::evaluate(
+  const unsigned int         degree,
+  const VectorizedArrayType *coefficients,
+  VectorizedArrayType       *values,
+  VectorizedArrayType       *tmp) const
+{
+  AssertIndexRange(degree, evaluation_matrices.size());
+
+  if (degree == 0)
+    {
+      std::fill_n(values,
+                  n_q_points(),
+                  coefficients[0] *
+                    Utilities::fixed_power<dim>(evaluation_matrices[0][0]));
+      return;
+    }
+
+  internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                   dim,
+                                   0,
+                                   0,
+                                   VectorizedArrayType,
+                                   Number>
+    eval(evaluation_matrices[degree],
+         AlignedVector<Number>(),
+         AlignedVector<Number>(),
+         degree + 1,
+         n_q_points_1d);
+  if constexpr (dim == 1)
+    eval.template values<0, true, false>(coefficients, values);
+  else if constexpr (dim == 2)
+    {
+      eval.template values<0, true, false>(coefficients, tmp);
+      eval.template values<1, true, false>(tmp, values);
+    }
+  else if constexpr (dim == 3)
+    {
+      eval.template values<0, true, false>(coefficients, values);
+      eval.template values<1, true, false>(values, tmp);
+      eval.template values<2, true, false>(tmp, values);
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+ArrayView<const VectorizedArrayType>
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::get_values(
+  const unsigned int                  cell_batch_index,
+  AlignedVector<VectorizedArrayType> &scratch_data) const
+{
+  AssertIndexRange(cell_batch_index, degrees.size());
+
+  const unsigned int         n_points = n_q_points();
+  const VectorizedArrayType *cell_data =
+    data.data() + data_offsets[cell_batch_index];
+  const unsigned int degree = degrees[cell_batch_index];
+  if (degree == numbers::invalid_unsigned_int)
+    return ArrayView<const VectorizedArrayType>(cell_data, n_points);
+
+  if (scratch_data.size() < 2 * n_points)
+    scratch_data.resize_fast(2 * n_points);
+  evaluate(degree,
+           cell_data,
+           scratch_data.data(),
+           scratch_data.data() + n_points);
+  return ArrayView<const VectorizedArrayType>(scratch_data.data(), n_points);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+unsigned int
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::get_degree(
+  const unsigned int cell_batch_index) const
+{
+  AssertIndexRange(cell_batch_index, degrees.size());
+  return degrees[cell_batch_index];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+unsigned int
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::n_q_points()
+  const
+{
+  return Utilities::fixed_power<dim>(n_q_points_1d);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+std::size_t
+CompressedCoefficientTable<dim, Number, VectorizedArrayType>::
+  memory_consumption() const
+{
+  std::size_t memory = MemoryConsumption::memory_consumption(degrees) +
+                       MemoryConsumption::memory_consumption(data_offsets) +
+                       data.memory_consumption();
+  for (const auto &matrix : evaluation_matrices)
+    memory += matrix.memory_consumption();
+  for (const auto &matrix : projection_matrices)
+    memory += matrix.memory_consumption();
+  return memory;
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -73,6 +73,20 @@ namespace internal
 
 
 
+    /**
+     * Return the lexicographic numbering of all degrees of freedom of the
+     * finite element @p fe. For elements composed of several base elements,
+     * the numberings of the individual base elements as computed by
+     * ShapeInfo are arranged one after the other in the order of the base
+     * elements.
+     */
+    template <int dim, typename Number>
+    std::vector<unsigned int>
+    compute_lexicographic_numbering_of_all_base_elements(
+      const FiniteElement<dim> &fe);
+
+
+
     /**
      * A helper class to apply constraints in matrix-free loops in
      * user code. It combines constraint related functionalities from
@@ -267,6 +281,44 @@ namespace internal
 
 
 
+    template <int dim, typename Number>
+    std::vector<unsigned int>
+    compute_lexicographic_numbering_of_all_base_elements(
+      const FiniteElement<dim> &fe)
+    {
+      std::vector<unsigned int> lexicographic_numbering;
+      lexicographic_numbering.reserve(fe.n_dofs_per_cell());
+
+      for (unsigned int b = 0; b < fe.n_base_elements(); ++b)
+        {
+          ShapeInfo<Number> shape_info;
+
+          if (fe.reference_cell().is_hyper_cube())
+            {
+              const Quadrature<1> dummy_quadrature(
+                std::vector<Point<1>>(1, Point<1>()));
+              shape_info.reinit(dummy_quadrature, fe, b);
+            }
+          else
+            {
+              const auto dummy_quadrature =
+                fe.reference_cell().get_gauss_type_quadrature(1);
+              shape_info.reinit(dummy_quadrature, fe, b);
+            }
+
+          lexicographic_numbering.insert(
+            lexicographic_numbering.end(),
+            shape_info.lexicographic_numbering.begin(),
+            shape_info.lexicographic_numbering.end());
+        }
+
+      AssertDimension(lexicographic_numbering.size(), fe.n_dofs_per_cell());
+
+      return lexicographic_numbering;
+    }
+
+
+
     template <int dim, typename Number, typename IndexType>
     ConstraintInfo<dim, Number, IndexType>::ConstraintInfo()
       : local_range({0, 0})
@@ -333,7 +385,16 @@ namespace internal
               shape_infos[i].reinit(dummy_quadrature, fes[i], 0);
             }
 
-          lexicographic_numbering[i] = shape_infos[i].lexicographic_numbering;
+          // the numbering of the ShapeInfo object only covers the first
+          // base element, so collect the numbering of all base elements
+          // for elements like FESystem(FE_Q(k)^dim, FE_Q(k-1))
+          if (fes[i].n_base_elements() == 1)
+            lexicographic_numbering[i] = shape_infos[i].lexicographic_numbering;
+          else
+            lexicographic_numbering[i] =
+              compute_lexicographic_numbering_of_all_base_elements<
+                dim,
+                typename Number::value_type>(fes[i]);
         }
       active_fe_indices.resize(n_cells);
     }
@@ -369,17 +430,16 @@ namespace internal
         cell->get_mg_dof_indices(local_dof_indices);
 
       {
-        AssertIndexRange(cell->active_fe_index(), shape_infos.size());
+        AssertIndexRange(cell->active_fe_index(),
+                         lexicographic_numbering.size());
 
-        const auto &lexicographic_numbering =
-          shape_infos[cell->active_fe_index()].lexicographic_numbering;
+        const auto &numbering =
+          lexicographic_numbering[cell->active_fe_index()];
 
-        AssertDimension(lexicographic_numbering.size(),
-                        local_dof_indices.size());
+        AssertDimension(numbering.size(), local_dof_indices.size());
 
         for (unsigned int i = 0; i < cell->get_fe().n_dofs_per_cell(); ++i)
-          local_dof_indices_lex[i] =
-            local_dof_indices[lexicographic_numbering[i]];
+          local_dof_indices_lex[i] = local_dof_indices[numbering[i]];
       }
 
       std::pair<unsigned short, unsigned short> constraint_iterator(0, 0);
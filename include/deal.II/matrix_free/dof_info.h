@@ -537,9 +537,40 @@ namespace internal
 
       /**
        * Reordered index storage for `IndexStorageVariants::interleaved`.
+       *
+       * @note This field is empty if all cell batches with interleaved
+       * storage can be represented by the compressed storage in
+       * @p dof_indices_interleaved_compressed.
        */
       std::vector<unsigned int> dof_indices_interleaved;
 
+      /**
+       * Compressed variant of @p dof_indices_interleaved, storing the indices
+       * of a cell batch as 16-bit offsets relative to the index in @p
+       * dof_indices_interleaved_compressed_start, using the same layout
+       * within a batch as @p dof_indices_interleaved. This halves the amount
+       * of index data to be loaded in cell loops whenever the indices of a
+       * cell batch span less than 65536 entries, which is the typical case
+       * for continuous elements and a numbering of the unknowns with
+       * locality. Only the compressed batches are stored, starting at the
+       * positions given by @p row_starts_interleaved_compressed.
+       */
+      std::vector<unsigned short> dof_indices_interleaved_compressed;
+
+      /**
+       * The smallest index of each cell batch stored in @p
+       * dof_indices_interleaved_compressed, or numbers::invalid_unsigned_int
+       * if the batch uses the uncompressed storage.
+       */
+      std::vector<unsigned int> dof_indices_interleaved_compressed_start;
+
+      /**
+       * The position of the indices of each cell batch within @p
+       * dof_indices_interleaved_compressed, or numbers::invalid_unsigned_int
+       * if the batch uses the uncompressed storage.
+       */
+      std::vector<unsigned int> row_starts_interleaved_compressed;
+
       /**
        * Compressed index storage for faster access than through @p
        * dof_indices used according to the description in IndexStorageVariants.
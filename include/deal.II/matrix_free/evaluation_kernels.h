@@ -2268,6 +2268,9 @@ namespace internal
 
       const auto element_type = fe_eval.get_shape_info().element_type;
       using ElementType       = MatrixFreeFunctions::ElementType;
+      using CellKernelVariant = MatrixFreeFunctions::CellKernelVariant;
+      const CellKernelVariant kernel_variant =
+        fe_eval.get_shape_info().cell_kernel_variant;
 
       Assert(fe_eval.get_shape_info().data.size() == 1 ||
                (fe_eval.get_shape_info().data.size() == dim &&
@@ -2316,7 +2319,9 @@ namespace internal
       // '<=' on type means tensor_symmetric or tensor_symmetric_hermite, see
       // shape_info.h for more details
       else if (fe_degree >= 0 &&
-               use_collocation_evaluation(fe_degree, n_q_points_1d) &&
+               (kernel_variant == CellKernelVariant::heuristic ?
+                  use_collocation_evaluation(fe_degree, n_q_points_1d) :
+                  kernel_variant == CellKernelVariant::collocation) &&
                element_type <= ElementType::tensor_symmetric)
         {
           evaluate_or_integrate<
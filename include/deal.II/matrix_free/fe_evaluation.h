@@ -2535,6 +2535,12 @@ inline FEEvaluationBase<dim,
       this->quadrature_points =
         this->mapped_geometry->get_data_storage().quadrature_points.begin();
     }
+  else
+    {
+      // the geometry data filled in reinit() must not be shared between
+      // copies that might be used concurrently
+      this->mapped_geometry.reset();
+    }
 
   this->set_data_pointers(scratch_data_array, n_components_);
 }
@@ -2613,6 +2619,7 @@ operator=(const FEEvaluationBase<dim,
   else
     {
       scratch_data_array = matrix_free->acquire_scratch_data();
+      this->mapped_geometry.reset();
     }
 
   this->set_data_pointers(scratch_data_array, n_components_);
@@ -2953,14 +2960,11 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
                             IndexStorageVariants::interleaved &&
       use_vectorized_path)
     {
-      const unsigned int *dof_indices =
-        dof_info.dof_indices_interleaved.data() +
-        dof_info.row_starts[this->cell * this->n_fe_components * n_lanes]
-          .first +
+      const unsigned int component_offset =
         this->dof_info
-            ->component_dof_indices_offset[this->active_fe_index]
-                                          [this->first_selected_component] *
-          n_lanes;
+          ->component_dof_indices_offset[this->active_fe_index]
+                                        [this->first_selected_component] *
+        n_lanes;
 
       std::array<typename VectorType::value_type *, n_components> src_ptrs;
       if (n_components == 1 || this->n_fe_components == 1)
@@ -2971,6 +2975,65 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
         src_ptrs[0] =
           const_cast<typename VectorType::value_type *>(src[0]->begin());
 
+      // Case 3a: the indices are stored as 16-bit offsets to the first index
+      // of the cell batch, which we pass as a constant offset to the
+      // vector access
+      if (!dof_info.dof_indices_interleaved_compressed_start.empty() &&
+          dof_info.dof_indices_interleaved_compressed_start[this->cell] !=
+            numbers::invalid_unsigned_int)
+        {
+          const unsigned int start =
+            dof_info.dof_indices_interleaved_compressed_start[this->cell];
+          const unsigned short *compressed_indices =
+            dof_info.dof_indices_interleaved_compressed.data() +
+            dof_info.row_starts_interleaved_compressed[this->cell] +
+            component_offset;
+          if (n_components == 1 || this->n_fe_components == 1)
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              src_ptrs[comp] += start;
+          else
+            src_ptrs[0] += start;
+
+          unsigned int dof_indices[n_lanes];
+          if (n_components == 1 || this->n_fe_components == 1)
+            for (unsigned int i = 0; i < dofs_per_component;
+                 ++i, compressed_indices += n_lanes)
+              {
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  dof_indices[v] = compressed_indices[v];
+                for (unsigned int comp = 0; comp < n_components; ++comp)
+                  operation.process_dof_gather(dof_indices,
+                                               *src[comp],
+                                               start,
+                                               src_ptrs[comp],
+                                               values_dofs[comp][i],
+                                               vector_selector);
+              }
+          else
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              for (unsigned int i = 0; i < dofs_per_component;
+                   ++i, compressed_indices += n_lanes)
+                {
+                  DEAL_II_OPENMP_SIMD_PRAGMA
+                  for (unsigned int v = 0; v < n_lanes; ++v)
+                    dof_indices[v] = compressed_indices[v];
+                  operation.process_dof_gather(dof_indices,
+                                               *src[0],
+                                               start,
+                                               src_ptrs[0],
+                                               values_dofs[comp][i],
+                                               vector_selector);
+                }
+          return;
+        }
+
+      const unsigned int *dof_indices =
+        dof_info.dof_indices_interleaved.data() +
+        dof_info.row_starts[this->cell * this->n_fe_components * n_lanes]
+          .first +
+        component_offset;
+
       if (n_components == 1 || this->n_fe_components == 1)
         for (unsigned int i = 0; i < dofs_per_component;
              ++i, dof_indices += n_lanes)
@@ -6844,6 +6907,26 @@ FEEvaluation<dim,
         this->mapping_data->jacobian_gradients_non_inverse[0].data() + offsets;
     }
 
+  // for general cells, the Jacobians might not be stored but need to be
+  // computed from the support points of the mapping
+  if (this->cell_type == internal::MatrixFreeFunctions::general &&
+      this->matrix_free->get_mapping_info().cell_geometry_on_the_fly)
+    {
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      this->matrix_free->get_mapping_info().compute_cell_geometry_on_the_fly(
+        cell_index,
+        this->quadrature_index,
+        mapping_storage,
+        this->mapped_geometry->get_scratch_data());
+      this->jacobian = mapping_storage.jacobians[0].data();
+      this->J_value  = mapping_storage.JxW_values.data();
+    }
+
   if (this->matrix_free->n_active_entries_per_cell_batch(this->cell) == n_lanes)
     {
       DEAL_II_OPENMP_SIMD_PRAGMA
@@ -6914,6 +6997,12 @@ FEEvaluation<dim,
                    cell_index / n_lanes));
     }
 
+  Assert(this->cell_type < internal::MatrixFreeFunctions::general ||
+           !this->matrix_free->get_mapping_info().cell_geometry_on_the_fly,
+         ExcMessage("Reinitialization with a custom set of cells is not "
+                    "supported with MatrixFree::AdditionalData::"
+                    "cell_geometry_on_the_fly."));
+
   // allocate memory for internal data storage
   if (this->mapped_geometry == nullptr)
     this->mapped_geometry =
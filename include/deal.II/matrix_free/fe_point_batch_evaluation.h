@@ -0,0 +1,580 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+#ifndef dealii_fe_point_batch_evaluation_h
+#define dealii_fe_point_batch_evaluation_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/derivative_form.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/ndarray.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_point_kernels.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
+#include <algorithm>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * Evaluation of finite element functions in arbitrary points of many cells
+ * at once. This class is an alternative to calling FEPointEvaluation::reinit()
+ * and FEPointEvaluation::evaluate() cell by cell for applications where each
+ * cell contains only a few points, as it is typical for particle simulations
+ * or immersed boundaries. FEPointEvaluation vectorizes over the points of a
+ * single cell, which leaves most SIMD lanes empty if the number of points per
+ * cell is small. In contrast, this class groups
+ * VectorizedArray<Number>::size() cells into a batch and assigns the $v$-th
+ * lane of all vectorized quantities to the $v$-th cell of the batch, i.e.,
+ * the lanes run over cells and the loop over the points of the cells is
+ * done in the outer loop. The evaluation uses the same kernels from
+ * tensor_product_point_kernels.h as FEPointEvaluation, but operates on full
+ * SIMD registers as long as the cells of a batch contain a similar number
+ * of points.
+ *
+ * The geometry is taken from a NonMatching::MappingInfo object that has been
+ * set up for all cells of interest by NonMatching::MappingInfo::reinit_cells().
+ * The cells are identified by the same index as in
+ * FEPointEvaluation::reinit(const unsigned int). The solution values on the
+ * cells are passed to evaluate() as one contiguous array, where the values of
+ * the $i$-th cell passed to reinit() start at position $i$ times
+ * FiniteElement::n_dofs_per_cell() and are given in the numbering of the
+ * finite element, e.g., as extracted by DoFCellAccessor::get_dof_values().
+ * When evaluating `n_components` copies of a scalar element, the values of
+ * a cell consist of the values of all copies one after the other, and the
+ * values of the $i$-th cell start at position $i$ times `n_components` times
+ * FiniteElement::n_dofs_per_cell().
+ * The typical use is
+ * @code
+ * NonMatching::MappingInfo<dim> mapping_info(mapping,
+ *                                            update_values | update_gradients);
+ * mapping_info.reinit_cells(cells, unit_points);
+ *
+ * FEPointBatchEvaluation<1, dim> evaluator(mapping_info, fe);
+ * evaluator.reinit(cell_indices);
+ * evaluator.evaluate(solution_values,
+ *                    EvaluationFlags::values | EvaluationFlags::gradients);
+ * for (unsigned int c = 0; c < evaluator.n_cells(); ++c)
+ *   for (unsigned int q = 0; q < evaluator.n_points(c); ++q)
+ *     {
+ *       const double         value    = evaluator.get_value(c, q);
+ *       const Tensor<1, dim> gradient = evaluator.get_gradient(c, q);
+ *       ...
+ *     }
+ * @endcode
+ *
+ * @note This class is only implemented for the finite elements with tensor
+ * product structure that are supported by the fast path of FEPointEvaluation
+ * and only provides evaluation, not integration.
+ */
+template <int n_components_,
+          int dim,
+          int spacedim    = dim,
+          typename Number = double>
+class FEPointBatchEvaluation
+{
+public:
+  static constexpr unsigned int dimension    = dim;
+  static constexpr unsigned int n_components = n_components_;
+
+  using number_type         = Number;
+  using VectorizedArrayType = VectorizedArray<Number>;
+  using ETT                 = typename internal::FEPointEvaluation::
+    EvaluatorTypeTraits<dim, spacedim, n_components, Number>;
+  using value_type    = typename ETT::value_type;
+  using gradient_type = typename ETT::real_gradient_type;
+
+  /**
+   * Constructor.
+   *
+   * @param mapping_info The MappingInfo object that holds the reference
+   * points and the geometry of the cells to be evaluated. It needs to be set
+   * up by NonMatching::MappingInfo::reinit_cells() before reinit() is called
+   * on the present object, and with update_gradients if gradients are to be
+   * evaluated.
+   *
+   * @param fe The FiniteElement object that is used for the evaluation on
+   * all cells. As for FEPointEvaluation, it is possible to either select
+   * @p n_components components of a multi-component element starting at
+   * @p first_selected_component, or to evaluate @p n_components copies of a
+   * scalar element whose values are sorted one after the other.
+   *
+   * @param first_selected_component For multi-component FiniteElement
+   * objects, this parameter allows to select a range of `n_components`
+   * components starting from this parameter.
+   */
+  FEPointBatchEvaluation(
+    const NonMatching::MappingInfo<dim, spacedim, Number> &mapping_info,
+    const FiniteElement<dim, spacedim>                    &fe,
+    const unsigned int first_selected_component = 0);
+
+  /**
+   * Collect the reference points and the inverse Jacobians of the cells
+   * with the given indices from the MappingInfo object and arrange them into
+   * batches of VectorizedArrayType::size() cells. The cells are numbered
+   * within the present object in the order given by @p cell_indices.
+   */
+  void
+  reinit(const ArrayView<const unsigned int> &cell_indices);
+
+  /**
+   * Evaluate the finite element function given by @p solution_values in the
+   * points of all cells passed to reinit(). The array @p solution_values
+   * contains the values of the degrees of freedom of all cells one after
+   * the other, in the order of the cells passed to reinit().
+   */
+  void
+  evaluate(const ArrayView<const Number>          &solution_values,
+           const EvaluationFlags::EvaluationFlags &evaluation_flags);
+
+  /**
+   * Return the number of cells passed to the last call of reinit().
+   */
+  unsigned int
+  n_cells() const;
+
+  /**
+   * Return the number of points on the given cell.
+   */
+  unsigned int
+  n_points(const unsigned int cell) const;
+
+  /**
+   * Return the value at the given point of the given cell after a call to
+   * evaluate() with EvaluationFlags::values set.
+   */
+  value_type
+  get_value(const unsigned int cell, const unsigned int point_index) const;
+
+  /**
+   * Return the gradient in real coordinates at the given point of the given
+   * cell after a call to evaluate() with EvaluationFlags::gradients set.
+   */
+  gradient_type
+  get_gradient(const unsigned int cell, const unsigned int point_index) const;
+
+private:
+  /**
+   * Pointer to the geometry information.
+   */
+  ObserverPointer<const NonMatching::MappingInfo<dim, spacedim, Number>>
+    mapping_info;
+
+  /**
+   * The number of solution values per cell, i.e., the number of degrees of
+   * freedom per cell of the finite element, multiplied by `n_components`
+   * when evaluating copies of a scalar element.
+   */
+  unsigned int dofs_per_cell;
+
+  /**
+   * The number of degrees of freedom per component of the selected base
+   * element.
+   */
+  unsigned int dofs_per_component;
+
+  /**
+   * The one-dimensional polynomials of the selected base element.
+   */
+  std::vector<Polynomials::Polynomial<double>> poly;
+
+  /**
+   * For all components and the degrees of freedom of a component in
+   * lexicographic order, the index within the cell-local numbering of the
+   * finite element.
+   */
+  std::vector<unsigned int> lexicographic_dof_indices;
+
+  /**
+   * The number of points on each cell passed to reinit().
+   */
+  std::vector<unsigned int> n_points_per_cell;
+
+  /**
+   * The offset of the points of each batch of cells into the vectorized
+   * data fields. The number of points of a batch is the maximal number of
+   * points among its cells.
+   */
+  std::vector<unsigned int> batch_offsets;
+
+  /**
+   * The reference points of the cells, vectorized over the cells of a
+   * batch. Lanes of cells with fewer points than the batch are filled by
+   * the last point of the respective cell.
+   */
+  AlignedVector<Point<dim, VectorizedArrayType>> unit_points;
+
+  /**
+   * The inverse Jacobians at the points, stored in the same layout as
+   * @p unit_points if the MappingInfo object provides them.
+   */
+  AlignedVector<DerivativeForm<1, spacedim, dim, VectorizedArrayType>>
+    inverse_jacobians;
+
+  /**
+   * Scratch array holding the solution values of the cells of a batch in
+   * lexicographic order.
+   */
+  AlignedVector<VectorizedArrayType> solution_renumbered;
+
+  /**
+   * Scratch array holding the values and derivatives of the one-dimensional
+   * polynomials at a point.
+   */
+  AlignedVector<dealii::ndarray<VectorizedArrayType, 2, dim>> shapes;
+
+  /**
+   * The values computed by evaluate().
+   */
+  AlignedVector<Tensor<1, n_components, VectorizedArrayType>> values;
+
+  /**
+   * The gradients computed by evaluate().
+   */
+  AlignedVector<
+    Tensor<1, n_components, Tensor<1, spacedim, VectorizedArrayType>>>
+    gradients;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int n_components_, int dim, int spacedim, typename Number>
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  FEPointBatchEvaluation(
+    const NonMatching::MappingInfo<dim, spacedim, Number> &mapping_info,
+    const FiniteElement<dim, spacedim>                    &fe,
+    const unsigned int first_selected_component)
+  : mapping_info(&mapping_info)
+  , dofs_per_cell(fe.n_dofs_per_cell())
+{
+  if (fe.n_components() > 1)
+    AssertIndexRange(first_selected_component + n_components,
+                     fe.n_components() + 1);
+
+  bool         same_base_element         = true;
+  unsigned int base_element_number       = 0;
+  unsigned int component_in_base_element = 0;
+  unsigned int component                 = 0;
+  for (; base_element_number < fe.n_base_elements(); ++base_element_number)
+    if (component + fe.element_multiplicity(base_element_number) >
+        first_selected_component)
+      {
+        if (fe.n_components() > 1 &&
+            first_selected_component + n_components >
+              component + fe.element_multiplicity(base_element_number))
+          same_base_element = false;
+        component_in_base_element = first_selected_component - component;
+        break;
+      }
+    else
+      component += fe.element_multiplicity(base_element_number);
+
+  AssertThrow(same_base_element &&
+                internal::FEPointEvaluation::is_fast_path_supported(
+                  fe, base_element_number),
+              ExcNotImplemented());
+
+  internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
+  shape_info.reinit(QMidpoint<1>(), fe, base_element_number);
+  dofs_per_component = shape_info.dofs_per_component_on_cell;
+  poly               = internal::FEPointEvaluation::get_polynomial_space(
+    fe.base_element(base_element_number));
+  if (n_components > fe.n_components())
+    dofs_per_cell = n_components * fe.n_dofs_per_cell();
+
+  // same access pattern as in FEPointEvaluation::prepare_evaluate_fast()
+  const std::vector<unsigned int> &renumber =
+    shape_info.lexicographic_numbering;
+  lexicographic_dof_indices.resize(n_components * dofs_per_component);
+  for (unsigned int comp = 0; comp < n_components; ++comp)
+    {
+      const unsigned int offset =
+        (component_in_base_element + comp) * dofs_per_component;
+      for (unsigned int i = 0; i < dofs_per_component; ++i)
+        lexicographic_dof_indices[comp * dofs_per_component + i] =
+          (n_components > fe.n_components()) ? renumber[i] + offset :
+                                               renumber[offset + i];
+    }
+
+  solution_renumbered.resize(n_components * dofs_per_component);
+  shapes.resize(poly.size());
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::reinit(
+  const ArrayView<const unsigned int> &cell_indices)
+{
+  using MappingVectorizedArrayType = typename NonMatching::
+    MappingInfo<dim, spacedim, Number>::VectorizedArrayType;
+
+  constexpr unsigned int n_lanes         = VectorizedArrayType::size();
+  constexpr unsigned int n_lanes_mapping = MappingVectorizedArrayType::size();
+
+  const unsigned int n_cells   = cell_indices.size();
+  const unsigned int n_batches = (n_cells + n_lanes - 1) / n_lanes;
+
+  std::vector<unsigned int> geometry_indices(n_cells);
+  n_points_per_cell.resize(n_cells);
+  for (unsigned int c = 0; c < n_cells; ++c)
+    {
+      geometry_indices[c] =
+        mapping_info->template compute_geometry_index_offset<false>(
+          cell_indices[c], numbers::invalid_unsigned_int);
+      n_points_per_cell[c] =
+        mapping_info->get_n_q_points_unvectorized(geometry_indices[c]);
+    }
+
+  batch_offsets.resize(n_batches + 1);
+  batch_offsets[0] = 0;
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      const auto begin = n_points_per_cell.begin() + b * n_lanes;
+      const auto end =
+        n_points_per_cell.begin() + std::min((b + 1) * n_lanes, n_cells);
+      batch_offsets[b + 1] = batch_offsets[b] + *std::max_element(begin, end);
+    }
+
+  const bool store_inverse_jacobians =
+    (mapping_info->get_update_flags_mapping() & update_inverse_jacobians) != 0;
+
+  unit_points.clear();
+  unit_points.resize(batch_offsets.back());
+  inverse_jacobians.clear();
+  if (store_inverse_jacobians)
+    inverse_jacobians.resize(batch_offsets.back());
+
+  for (unsigned int b = 0; b < n_batches; ++b)
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      {
+        // fill empty lanes of the last batch with the data of its first cell
+        const unsigned int cell = (b * n_lanes + v < n_cells) ?
+                                    b * n_lanes + v :
+                                    b * n_lanes;
+        const unsigned int n_points = n_points_per_cell[cell];
+        if (n_points == 0)
+          continue;
+
+        const unsigned int geometry_index = geometry_indices[cell];
+        const auto        *unit_point_ptr = mapping_info->get_unit_point(
+          mapping_info->compute_unit_point_index_offset(geometry_index));
+        const auto *inverse_jacobian_ptr =
+          store_inverse_jacobians ?
+            mapping_info->get_inverse_jacobian(
+              mapping_info->compute_compressed_data_index_offset(
+                geometry_index),
+              true) :
+            nullptr;
+        const bool affine_cell =
+          mapping_info->get_cell_type(geometry_index) <=
+          internal::MatrixFreeFunctions::GeometryType::affine;
+
+        for (unsigned int q = batch_offsets[b]; q < batch_offsets[b + 1]; ++q)
+          {
+            const unsigned int q_cell =
+              std::min(q - batch_offsets[b], n_points - 1);
+            for (unsigned int d = 0; d < dim; ++d)
+              unit_points[q][d][v] =
+                unit_point_ptr[q_cell / n_lanes_mapping][d]
+                              [q_cell % n_lanes_mapping];
+            if (store_inverse_jacobians)
+              {
+                const auto &inverse_jacobian =
+                  inverse_jacobian_ptr[affine_cell ? 0 : q_cell];
+                for (unsigned int d = 0; d < dim; ++d)
+                  for (unsigned int e = 0; e < spacedim; ++e)
+                    inverse_jacobians[q][d][e][v] = inverse_jacobian[d][e];
+              }
+          }
+      }
+
+  values.resize_fast(batch_offsets.back());
+  if (store_inverse_jacobians)
+    gradients.resize_fast(batch_offsets.back());
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::evaluate(
+  const ArrayView<const Number>          &solution_values,
+  const EvaluationFlags::EvaluationFlags &evaluation_flags)
+{
+  AssertDimension(solution_values.size(), n_cells() * dofs_per_cell);
+  if (evaluation_flags & EvaluationFlags::gradients)
+    Assert(inverse_jacobians.size() == unit_points.size(),
+           internal::FEPointEvaluation::
+             ExcFEPointEvaluationAccessToUninitializedMappingField(
+               "update_gradients"));
+
+  constexpr unsigned int n_lanes  = VectorizedArrayType::size();
+  const int              n_shapes = poly.size();
+
+  for (unsigned int b = 0; b + 1 < batch_offsets.size(); ++b)
+    {
+      if (batch_offsets[b + 1] == batch_offsets[b])
+        continue;
+
+      // gather the solution values of the cells of the batch into the lanes
+      const unsigned int n_filled_lanes =
+        std::min(n_lanes, n_cells() - b * n_lanes);
+      const Number *cell_values =
+        solution_values.data() + b * n_lanes * dofs_per_cell;
+      for (unsigned int i = 0; i < lexicographic_dof_indices.size(); ++i)
+        {
+          VectorizedArrayType value = {};
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            value[v] =
+              cell_values[v * dofs_per_cell + lexicographic_dof_indices[i]];
+          solution_renumbered[i] = value;
+        }
+
+      for (unsigned int q = batch_offsets[b]; q < batch_offsets[b + 1]; ++q)
+        {
+          internal::compute_values_of_array(
+            shapes.data(),
+            poly,
+            unit_points[q],
+            (evaluation_flags & EvaluationFlags::gradients) ? 1 : 0);
+
+          for (unsigned int comp = 0; comp < n_components; ++comp)
+            {
+              const VectorizedArrayType *comp_values =
+                solution_renumbered.data() + comp * dofs_per_component;
+              if (evaluation_flags & EvaluationFlags::gradients)
+                {
+                  const auto result =
+                    internal::evaluate_tensor_product_value_and_gradient_shapes<
+                      dim,
+                      VectorizedArrayType,
+                      VectorizedArrayType,
+                      1,
+                      false>(shapes.data(), n_shapes, comp_values);
+                  values[q][comp] = result[dim];
+                  for (unsigned int e = 0; e < spacedim; ++e)
+                    {
+                      VectorizedArrayType gradient =
+                        inverse_jacobians[q][0][e] * result[0];
+                      for (unsigned int d = 1; d < dim; ++d)
+                        gradient += inverse_jacobians[q][d][e] * result[d];
+                      gradients[q][comp][e] = gradient;
+                    }
+                }
+              else
+                values[q][comp] =
+                  internal::evaluate_tensor_product_value_shapes<
+                    dim,
+                    VectorizedArrayType,
+                    VectorizedArrayType,
+                    false>(shapes.data(), n_shapes, comp_values);
+            }
+        }
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline unsigned int
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::n_cells() const
+{
+  return n_points_per_cell.size();
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline unsigned int
+FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::n_points(
+  const unsigned int cell) const
+{
+  AssertIndexRange(cell, n_points_per_cell.size());
+  return n_points_per_cell[cell];
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline typename FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  value_type
+  FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::get_value(
+    const unsigned int cell,
+    const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, n_points(cell));
+  const unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int lane    = cell % n_lanes;
+  const auto &value = values[batch_offsets[cell / n_lanes] + point_index];
+  if constexpr (n_components == 1)
+    return value[0][lane];
+  else
+    {
+      value_type result;
+      for (unsigned int comp = 0; comp < n_components; ++comp)
+        result[comp] = value[comp][lane];
+      return result;
+    }
+}
+
+
+
+template <int n_components_, int dim, int spacedim, typename Number>
+inline typename FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::
+  gradient_type
+  FEPointBatchEvaluation<n_components_, dim, spacedim, Number>::get_gradient(
+    const unsigned int cell,
+    const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, n_points(cell));
+  const unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int lane    = cell % n_lanes;
+  const auto &gradient = gradients[batch_offsets[cell / n_lanes] + point_index];
+  gradient_type result;
+  for (unsigned int comp = 0; comp < n_components; ++comp)
+    for (unsigned int e = 0; e < spacedim; ++e)
+      if constexpr (n_components == 1)
+        result[e] = gradient[comp][e][lane];
+      else
+        result[comp][e] = gradient[comp][e][lane];
+  return result;
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
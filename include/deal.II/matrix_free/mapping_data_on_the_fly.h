@@ -127,6 +127,14 @@ namespace internal
       MappingInfoStorage<dim, dim, Number> &
       get_data_storage();
 
+      /**
+       * Return a scratch array for temporary results, e.g. for the
+       * polynomial evaluation of the geometry when the data storage is
+       * filled manually.
+       */
+      AlignedVector<Number> &
+      get_scratch_data();
+
       /**
        * Return a reference to 1d quadrature underlying this object.
        */
@@ -161,6 +169,11 @@ namespace internal
        * MappingInfo.
        */
       MappingInfoStorage<dim, dim, Number> mapping_info_storage;
+
+      /**
+       * Scratch array returned by get_scratch_data().
+       */
+      AlignedVector<Number> scratch_data;
     };
 
 
@@ -300,6 +313,15 @@ namespace internal
 
 
 
+    template <int dim, typename Number>
+    inline AlignedVector<Number> &
+    MappingDataOnTheFly<dim, Number>::get_scratch_data()
+    {
+      return scratch_data;
+    }
+
+
+
     template <int dim, typename Number>
     inline const Quadrature<1> &
     MappingDataOnTheFly<dim, Number>::get_quadrature() const
@@ -31,6 +31,7 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <memory>
 
@@ -58,6 +59,10 @@ namespace internal
        * for different kinds of iterators, e.g. standard DoFHandler,
        * multigrid, etc.)  on a fixed Triangulation. In addition, a mapping
        * and several 1d quadrature formulas are given.
+       *
+       * If @p cell_geometry_on_the_fly is set, only the support points of
+       * the mapping are kept for cells of general type, see
+       * compute_cell_geometry_on_the_fly().
        */
       void
       initialize(
@@ -71,7 +76,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        cell_geometry_on_the_fly = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -93,6 +99,27 @@ namespace internal
       GeometryType
       get_cell_type(const unsigned int cell_chunk_no) const;
 
+      /**
+       * Compute the inverse transposed Jacobians and the JxW values on the
+       * quadrature points with index @p quad_index of the cell batch
+       * @p cell_batch_index from the support points of the mapping stored in
+       * cell_support_points, and write them into the first entries of the
+       * fields `jacobians[0]` and `JxW_values` of @p cell_storage. The
+       * interpolation to the quadrature points uses the same sum
+       * factorization kernels as FEEvaluation, working on the array
+       * @p scratch_data for temporary results. The geometry is evaluated in
+       * the precision of @p VectorizedArrayType.
+       *
+       * This function may only be called for cells of type
+       * GeometryType::general and if cell_geometry_on_the_fly is set.
+       */
+      void
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                                 cell_batch_index,
+        const unsigned int                                 quad_index,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &cell_storage,
+        AlignedVector<VectorizedArrayType>                &scratch_data) const;
+
       /**
        * Clear all data fields in this class.
        */
@@ -198,6 +225,37 @@ namespace internal
        */
       std::vector<std::vector<ReferenceCell<dim>>> reference_cell_types;
 
+      /**
+       * Whether the Jacobians and JxW values of cells of general type are
+       * computed on the fly from cell_support_points rather than stored in
+       * cell_data, see MatrixFree::AdditionalData::cell_geometry_on_the_fly.
+       * This is only possible for a MappingQ without hp-adaptivity; for all
+       * other cases, the variable is reset to `false` during initialization.
+       */
+      bool cell_geometry_on_the_fly = false;
+
+      /**
+       * The support points of the mapping on the cell batches of general
+       * type, filled if cell_geometry_on_the_fly is set. The `dim`
+       * components of the points are stored one after another, each in the
+       * lexicographic numbering of the Gauss-Lobatto points of the MappingQ.
+       */
+      AlignedVector<VectorizedArrayType> cell_support_points;
+
+      /**
+       * The index into cell_support_points where the data of a cell batch
+       * starts. Entries for cells of other type than GeometryType::general
+       * are invalid.
+       */
+      std::vector<unsigned int> cell_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the support points of the mapping to
+       * the cell quadrature points for each quadrature formula, filled if
+       * cell_geometry_on_the_fly is set.
+       */
+      std::vector<ShapeInfo<Number>> cell_support_point_shape_info;
+
       /**
        * Internal function to compute the geometry for the case the mapping is
        * a MappingQ and a single quadrature formula per slot (non-hp-case) is
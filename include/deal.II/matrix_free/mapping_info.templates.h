@@ -50,6 +50,9 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
+      cell_support_points.clear();
+      cell_support_point_offsets.clear();
+      cell_support_point_shape_info.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
     }
@@ -69,11 +72,13 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        cell_geometry_on_the_fly)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->mapping_collection       = mapping;
+      this->mapping                  = &mapping->operator[](0);
+      this->cell_geometry_on_the_fly = cell_geometry_on_the_fly;
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -188,6 +193,10 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          // the geometry can only be computed on the fly from the support
+          // points of a MappingQ
+          this->cell_geometry_on_the_fly = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -226,6 +235,10 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          // the geometry can only be computed on the fly from the support
+          // points of a MappingQ
+          this->cell_geometry_on_the_fly = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -1152,7 +1165,8 @@ namespace internal
        * MappingQ-derived mappings on a range of cells calling into the tensor
        * product evaluators of the matrix-free framework, using a
        * polynomial expansion of the cell geometry underlying the MappingQ
-       * class.
+       * class. If @p store_general_cells is false, the Jacobians and JxW
+       * values of cells of general type are not written into @p my_data.
        */
       template <int dim,
                 typename Number,
@@ -1169,6 +1183,7 @@ namespace internal
         const UpdateFlags            update_flags_cells,
         const AlignedVector<double> &plain_quadrature_points,
         const ShapeInfo<double>     &shape_info,
+        const bool                   store_general_cells,
         MappingInfoStorage<dim, dim, VectorizedArrayType> &my_data)
       {
         constexpr unsigned int n_lanes   = VectorizedArrayType::size();
@@ -1275,6 +1290,9 @@ namespace internal
                         (void)cell_array;
                       }
 
+                    if (cell_type[cell] > affine && !store_general_cells)
+                      continue;
+
                     const Tensor<2, dim, VectorizedDouble> inv_jac =
                       transpose(invert(jac));
 
@@ -2677,6 +2695,12 @@ namespace internal
         &this->mapping_collection->operator[](0));
       Assert(mapping_q != nullptr, ExcInternalError());
 
+      AssertThrow(!cell_geometry_on_the_fly ||
+                    !(update_flags_cells & update_jacobian_grads),
+                  ExcMessage("The computation of the geometry on the fly "
+                             "does not support the gradients of the "
+                             "Jacobian (e.g. for hessians of the solution)."));
+
       const unsigned int mapping_degree = mapping_q->get_degree();
       const unsigned int n_mapping_points =
         Utilities::pow(mapping_degree + 1, dim);
@@ -2746,8 +2770,19 @@ namespace internal
       // not the same as the degree of the underlying finite element shape
       // functions or the quadrature points; shape info is merely a vehicle to
       // return us the right interpolation matrices from the cell support
-      // points to the cell and face quadrature points.
-      std::vector<ShapeInfo<double>> shape_infos(cell_data.size());
+      // points to the cell and face quadrature points. If the geometry of
+      // general cells is evaluated on the fly in double precision, the same
+      // objects are needed later, so we create them in place.
+      cell_support_points.clear();
+      cell_support_point_offsets.clear();
+      cell_support_point_shape_info.clear();
+      std::vector<ShapeInfo<double>>  shape_infos_double;
+      std::vector<ShapeInfo<double>> *shape_infos_ptr = &shape_infos_double;
+      if constexpr (std::is_same_v<Number, double>)
+        if (cell_geometry_on_the_fly)
+          shape_infos_ptr = &cell_support_point_shape_info;
+      std::vector<ShapeInfo<double>> &shape_infos = *shape_infos_ptr;
+      shape_infos.resize(cell_data.size());
       {
         FE_DGQ<dim> fe_geometry(mapping_degree);
         for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2805,7 +2840,9 @@ namespace internal
               max_size =
                 std::max(max_size,
                          my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+                           (cell_type[cell] <= affine ?
+                              2 :
+                              (cell_geometry_on_the_fly ? 0 : n_q_points)));
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2850,18 +2887,63 @@ namespace internal
                 update_flags_cells,
                 plain_quadrature_points,
                 shape_infos[my_q],
+                !cell_geometry_on_the_fly,
                 my_data);
             },
             std::max(cell_type.size() / MultithreadInfo::n_threads() / 2,
                      std::size_t(2U)));
         }
 
+      // step 5: if the geometry of general cells is evaluated on the fly,
+      // keep the support points of the mapping on those cells, vectorized
+      // over the cell batch, and the interpolation matrices to the
+      // quadrature points
+      if (cell_geometry_on_the_fly)
+        {
+          const unsigned int stride = dim * n_mapping_points;
+          cell_support_point_offsets.resize(cell_type.size(),
+                                            numbers::invalid_unsigned_int);
+          unsigned int n_general_batches = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general && process_cell[cell])
+              cell_support_point_offsets[cell] = stride * n_general_batches++;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general && !process_cell[cell])
+              cell_support_point_offsets[cell] =
+                cell_support_point_offsets[cell_data_index_vect[cell]];
+
+          cell_support_points.resize_fast(stride * n_general_batches);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general && process_cell[cell])
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                {
+                  const double *source = plain_quadrature_points.data() +
+                                         (cell * n_lanes + v) * stride;
+                  VectorizedArrayType *destination =
+                    cell_support_points.data() +
+                    cell_support_point_offsets[cell];
+                  for (unsigned int i = 0; i < stride; ++i)
+                    destination[i][v] = source[i];
+                }
+
+          // in single precision, the interpolation matrices of step 2
+          // cannot be used by the evaluation kernels
+          if constexpr (!std::is_same_v<Number, double>)
+            {
+              cell_support_point_shape_info.resize(cell_data.size());
+              FE_DGQ<dim> fe_geometry(mapping_degree);
+              for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+                cell_support_point_shape_info[my_q].reinit(
+                  cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+            }
+        }
+
       const std::vector<FaceToCellTopology<VectorizedArrayType::size()>>
         &faces = face_info.faces;
       if (faces.empty())
         return;
 
-      // step 5: find compression of faces with vectorization
+      // step 6: find compression of faces with vectorization
       std::map<std::array<unsigned int, 2 * n_lanes + 3>, unsigned int>
         compressed_faces;
 
@@ -2912,14 +2994,14 @@ namespace internal
                          preliminary_cell_type[faces[face].cells_exterior[i]]);
         }
 
-      // step 6: compute the data on faces from the cached cell quadrature
+      // step 7: compute the data on faces from the cached cell quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < face_data.size(); ++my_q)
         {
           MappingInfoStorage<dim - 1, dim, VectorizedArrayType> &my_data =
             face_data[my_q];
 
-          // step 6a: set the index offsets, find out how much to allocate,
+          // step 7a: set the index offsets, find out how much to allocate,
           // and allocate the memory
           const unsigned int n_q_points = my_data.descriptor[0].n_q_points;
           unsigned int       max_size   = 0;
@@ -2965,7 +3047,7 @@ namespace internal
                                                     n_q_points);
             }
 
-          // step 6b: go through the faces and compute the information using
+          // step 7b: go through the faces and compute the information using
           // similar evaluators as for the matrix-free face integrals
           dealii::parallel::apply_to_subranges(
             0U,
@@ -2989,7 +3071,7 @@ namespace internal
                      std::size_t(2U)));
         }
 
-      // step 6c: figure out if normal vectors are the same on some of the
+      // step 7c: figure out if normal vectors are the same on some of the
       // faces which allows us to set the flat_faces face type
       unsigned int quad_with_most_points = 0;
       for (unsigned int my_q = 1; my_q < face_data.size(); ++my_q)
@@ -3024,7 +3106,7 @@ namespace internal
         std::max(face_type.size() / MultithreadInfo::n_threads() / 2,
                  std::size_t(2U)));
 
-      // step 7: compute the face data by cells. This still needs to be
+      // step 8: compute the face data by cells. This still needs to be
       // transitioned to extracting the information from cell quadrature
       // points but we need to figure out the correct indices of neighbors
       // within the list of arrays still
@@ -3364,6 +3446,56 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                                 cell_batch_index,
+        const unsigned int                                 quad_index,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &cell_storage,
+        AlignedVector<VectorizedArrayType>                &scratch_data) const
+    {
+      Assert(cell_geometry_on_the_fly, ExcNotInitialized());
+      AssertIndexRange(cell_batch_index, cell_support_point_offsets.size());
+      AssertIndexRange(quad_index, cell_support_point_shape_info.size());
+      Assert(cell_type[cell_batch_index] == general, ExcInternalError());
+
+      const ShapeInfo<Number> &shape_info =
+        cell_support_point_shape_info[quad_index];
+      const unsigned int n_q_points = shape_info.n_q_points;
+      const Number      *weights =
+        cell_data[quad_index].descriptor[0].quadrature_weights.data();
+
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      eval.set_data_pointers(&scratch_data, dim);
+      FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+        dim,
+        EvaluationFlags::gradients,
+        cell_support_points.data() +
+          cell_support_point_offsets[cell_batch_index],
+        eval);
+
+      if (cell_storage.JxW_values.size() < n_q_points)
+        {
+          cell_storage.JxW_values.resize_fast(n_q_points);
+          cell_storage.jacobians[0].resize_fast(n_q_points);
+        }
+
+      const VectorizedArrayType *gradients = eval.begin_gradients();
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] = gradients[e + (d * n_q_points + q) * dim];
+
+          cell_storage.JxW_values[q]   = determinant(jac) * weights[q];
+          cell_storage.jacobians[0][q] = transpose(invert(jac));
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     std::size_t
     MappingInfo<dim, Number, VectorizedArrayType>::memory_consumption() const
@@ -3375,6 +3507,11 @@ namespace internal
       memory += face_type.capacity() * sizeof(GeometryType);
       memory += faces_by_cells_type.capacity() *
                 ReferenceCells::max_n_faces<dim>() * sizeof(GeometryType);
+      memory += MemoryConsumption::memory_consumption(cell_support_points);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_support_point_offsets);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_support_point_shape_info);
       memory += sizeof(*this);
       return memory;
     }
@@ -3403,6 +3540,16 @@ namespace internal
                                           ReferenceCells::max_n_faces<dim>() *
                                           sizeof(GeometryType));
 
+      if (cell_geometry_on_the_fly)
+        {
+          out << "    Cell support points:             ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(cell_support_points) +
+              MemoryConsumption::memory_consumption(
+                cell_support_point_offsets));
+        }
+
       for (unsigned int j = 0; j < cell_data.size(); ++j)
         {
           out << "    Data component " << j << std::endl;
@@ -47,6 +47,7 @@
 #include <cstdlib>
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
 
 
@@ -190,7 +191,10 @@ public:
    *
    * Finally, @p allow_ghosted_vectors_in_loops allows to enable and disable
    * checks and @p communicator_sm gives the MPI communicator to be used
-   * if MPI-3.0 shared-memory features should be used.
+   * if MPI-3.0 shared-memory features should be used. The variable
+   * @p communicator allows to restrict the vector partitioners and the
+   * collective operations to a subset of the processes of the
+   * triangulation.
    */
   struct AdditionalData
   {
@@ -263,6 +267,11 @@ public:
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , store_ghost_cells(false)
       , communicator_sm(MPI_COMM_SELF)
+      , communicator(MPI_COMM_NULL)
+      , cell_geometry_on_the_fly(false)
+      , order_cells_along_hilbert_curve(false)
+      , hp_merge_identical_elements(false)
+      , tune_cell_kernels(false)
     {}
 
     /**
@@ -290,6 +299,11 @@ public:
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , store_ghost_cells(other.store_ghost_cells)
       , communicator_sm(other.communicator_sm)
+      , communicator(other.communicator)
+      , cell_geometry_on_the_fly(other.cell_geometry_on_the_fly)
+      , order_cells_along_hilbert_curve(other.order_cells_along_hilbert_curve)
+      , hp_merge_identical_elements(other.hp_merge_identical_elements)
+      , tune_cell_kernels(other.tune_cell_kernels)
     {}
 
     /**
@@ -562,6 +576,110 @@ public:
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
     MPI_Comm communicator_sm;
+
+    /**
+     * MPI communicator used for the vector partitioners and the collective
+     * operations of this class instead of the communicator of the
+     * triangulation underlying the DoFHandler objects. This allows to
+     * restrict the communication on coarse multigrid levels, where only few
+     * processes own cells, to those processes, see
+     * MGTransferGlobalCoarseningTools::create_level_communicator(). All
+     * processes that own degrees of freedom need to be part of this
+     * communicator, whereas processes without degrees of freedom may pass a
+     * communicator of their own. This option is only supported on the
+     * active cells, i.e., without setting @p mg_level. Default:
+     * MPI_COMM_NULL, which selects the communicator of the triangulation.
+     */
+    MPI_Comm communicator;
+
+    /**
+     * Option to control how the geometry is represented on cells that are
+     * neither Cartesian nor affine. By default, the inverse Jacobians and
+     * the JxW values are precomputed and stored for all quadrature points,
+     * which amounts to $d^2+1$ numbers per quadrature point and makes the
+     * memory transfer for the geometry dominate the cell loop of
+     * higher-order operators on deformed meshes. If set to true, only the
+     * $(k+1)^d$ support points of a MappingQ of degree $k$ are stored per
+     * cell and FEEvaluation::reinit() recomputes the Jacobians by sum
+     * factorization, trading memory transfer for some additional arithmetic.
+     * The results agree with the stored variant up to roundoff, but the
+     * geometry is evaluated in the precision of the MatrixFree object
+     * rather than in double precision.
+     *
+     * This option only takes effect if the mapping is a MappingQ and no
+     * hp-adaptivity is used, and it cannot be combined with
+     * update_jacobian_grads for the cells. The geometry data on faces is not
+     * affected. FEEvaluation::reinit() with a custom set of cell indices is
+     * not supported with this option. The default value is false.
+     */
+    bool cell_geometry_on_the_fly;
+
+    /**
+     * By default, the cells are collected by descending from the cells of the
+     * coarse mesh to their active children (or, on a multigrid level, in the
+     * order of the level cells), which gives a z-ordering within each coarse
+     * cell but follows the possibly unstructured numbering of the coarse mesh
+     * otherwise. If this flag is set, the locally owned cells (and the ghost
+     * cells, if stored) are instead ordered along a Hilbert curve through the
+     * cell centers before the cell batches are formed. Consecutive batches
+     * then share more vertices, edges and faces, which increases the reuse
+     * of vector entries in caches during the cell loop.
+     *
+     * The full benefit requires a numbering of the unknowns that follows the
+     * resulting cell loop, which is obtained by calling
+     * DoFRenumbering::matrix_free_data_locality() with the same
+     * AdditionalData before setting up this class. The default value is
+     * false.
+     */
+    bool order_cells_along_hilbert_curve;
+
+    /**
+     * In hp-mode, the cells are grouped into batches by their active FE
+     * index, and each index forms its own, possibly partially filled, cell
+     * batches (and, with threads, one or more partially filled batches per
+     * partition). For collections that contain the same element several
+     * times, e.g. to mark different materials or because FE_Nothing is only
+     * used for some indices, this leaves SIMD lanes empty for no reason. If
+     * this flag is set, all FE indices whose finite elements coincide in all
+     * DoFHandler objects (according to FiniteElement::operator==), whose
+     * quadrature formulas coincide in all hp::QCollection objects, and which
+     * use the same mapping are placed into the same category, represented by
+     * the smallest of these indices.
+     *
+     * As a consequence, get_cell_active_fe_index() and
+     * create_cell_subrange_hp_by_index() report the representative index
+     * rather than the index set on the individual cells; cell ranges for the
+     * other indices of such a group are empty. Since the elements are
+     * identical, the evaluation with FEEvaluation is not affected, but user
+     * code that attaches additional meaning to the FE index of a cell batch
+     * must look up the index of the individual cells instead. The default
+     * value is false.
+     */
+    bool hp_merge_identical_elements;
+
+    /**
+     * For elements with symmetric 1d shape functions and more quadrature
+     * points than degrees of freedom per direction, FEEvaluation can either
+     * evaluate and integrate directly on the shape functions or go through
+     * a transformation to the collocation space of the quadrature points,
+     * see internal::MatrixFreeFunctions::CellKernelVariant. By default, a
+     * fixed heuristic based on operation counts selects the variant. If this
+     * flag is set, reinit() instead times both variants on a cell batch for
+     * each combination of element, polynomial degree, and number of
+     * quadrature points in use, and stores the faster variant in the
+     * respective ShapeInfo object, accessible via get_shape_info(). The
+     * switch from the heuristic choice is only made if the other variant is
+     * at least five percent faster. The timings are accumulated over all
+     * MPI processes, so that all processes select the same variant, and the
+     * choice is cached for subsequent calls to reinit() on the same object.
+     *
+     * Only the cell kernels of FEEvaluation with the polynomial degree given
+     * as template argument or among the precompiled degrees of the runtime
+     * dispatch are affected; face kernels always use the heuristic. As the
+     * two variants round differently, results may differ in the last digits
+     * between different machines. The default value is false.
+     */
+    bool tune_cell_kernels;
   };
 
   /**
@@ -1981,6 +2099,21 @@ public:
   unsigned int
   n_active_entries_per_cell_batch(const unsigned int cell_batch_index) const;
 
+  /**
+   * Return the fraction of SIMD lanes in the n_cell_batches() cell batches
+   * of the locally owned cells that correspond to actual cells of the mesh,
+   * i.e., n_physical_cells() divided by `n_cell_batches() *
+   * VectorizedArrayType::size()`. A value of one means that all batches are
+   * completely filled. Considerably smaller values typically appear for
+   * hp-adaptive computations on small meshes or for many vectorization
+   * categories, as every category forms its own batches, and indicate that
+   * part of the arithmetic throughput is spent on padding. See also
+   * AdditionalData::cell_vectorization_categories_strict and
+   * AdditionalData::hp_merge_identical_elements.
+   */
+  double
+  get_cell_lane_utilization() const;
+
   /**
    * Use this function to find out how many faces over the length of
    * vectorization data types correspond to real faces (both interior and
@@ -2266,14 +2399,26 @@ private:
    * Initializes the fields in DoFInfo together with the constraint pool that
    * holds all different weights in the constraints (not part of DoFInfo
    * because several DoFInfo classes can have the same weights which
-   * consequently only need to be stored once).
+   * consequently only need to be stored once). The vector @p
+   * fe_index_category maps each FE index of an hp-collection to the index
+   * that represents it when forming cell batches; an empty vector keeps the
+   * FE indices as they are.
    */
   template <typename number2>
   void
   initialize_indices(
     const std::vector<const AffineConstraints<number2> *> &constraint,
     const std::vector<IndexSet>                           &locally_owned_set,
-    const AdditionalData                                  &additional_data);
+    const AdditionalData                                  &additional_data,
+    const std::vector<unsigned int>                       &fe_index_category);
+
+  /**
+   * Times the cell kernel variants of FEEvaluation for all elements that
+   * support several of them and stores the faster one in the ShapeInfo
+   * objects, see AdditionalData::tune_cell_kernels.
+   */
+  void
+  tune_cell_kernels();
 
   /**
    * Initializes the DoFHandlers based on a DoFHandler<dim> argument.
@@ -2403,6 +2548,15 @@ private:
    * DoFHandler is in hp-mode, the value is 0.
    */
   unsigned int first_hp_dof_handler_index;
+
+  /**
+   * The cell kernel variants selected by tune_cell_kernels() for the
+   * combinations of element type, polynomial degree, and number of
+   * quadrature points per direction timed so far on this object.
+   */
+  std::map<std::array<unsigned int, 3>,
+           internal::MatrixFreeFunctions::CellKernelVariant>
+    tuned_cell_kernel_variants;
 };
 
 
@@ -2838,6 +2992,19 @@ MatrixFree<dim, Number, VectorizedArrayType>::n_active_entries_per_cell_batch(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+inline double
+MatrixFree<dim, Number, VectorizedArrayType>::get_cell_lane_utilization() const
+{
+  const unsigned int n_batches = n_cell_batches();
+  if (n_batches == 0)
+    return 1.;
+  return static_cast<double>(n_physical_cells()) /
+         (static_cast<double>(n_batches) * VectorizedArrayType::size());
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 inline unsigned int
 MatrixFree<dim, Number, VectorizedArrayType>::n_active_entries_per_face_batch(
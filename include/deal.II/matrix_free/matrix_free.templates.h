@@ -23,6 +23,7 @@
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -40,6 +41,7 @@
 #include <deal.II/matrix_free/constraint_info.h>
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/face_setup_internal.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
@@ -49,7 +51,13 @@
 #  include <tbb/concurrent_unordered_map.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <set>
 
 //
 // TBB with oneAPI API has deprecated and removed the
@@ -357,6 +365,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::copy_from(
   mapping_is_initialized     = v.mapping_is_initialized;
   mg_level                   = v.mg_level;
   first_hp_dof_handler_index = v.first_hp_dof_handler_index;
+  tuned_cell_kernel_variants = v.tuned_cell_kernel_variants;
 }
 
 
@@ -460,7 +469,14 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
       task_info.allow_ghosted_vectors_in_loops =
         additional_data.allow_ghosted_vectors_in_loops;
 
-      task_info.communicator    = dof_handler[0]->get_mpi_communicator();
+      Assert(additional_data.communicator == MPI_COMM_NULL ||
+               additional_data.mg_level == numbers::invalid_unsigned_int,
+             ExcMessage("A separate communicator can only be selected for "
+                        "the active cells of a triangulation."));
+      task_info.communicator =
+        additional_data.communicator != MPI_COMM_NULL ?
+          additional_data.communicator :
+          dof_handler[0]->get_mpi_communicator();
       task_info.communicator_sm = additional_data.communicator_sm;
       task_info.my_pid =
         Utilities::MPI::this_mpi_process(task_info.communicator);
@@ -504,11 +520,50 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 #endif
         task_info.scheme = internal::MatrixFreeFunctions::TaskInfo::none;
 
+      // in hp-mode, possibly map FE indices with identical elements,
+      // quadrature formulas and mappings to a common category for forming
+      // the cell batches
+      std::vector<unsigned int> fe_index_category;
+      if (additional_data.hp_merge_identical_elements &&
+          hp_dof_handler_index.size() > 0)
+        {
+          unsigned int n_fe_indices = 1;
+          for (const unsigned int no : hp_dof_handler_index)
+            n_fe_indices = std::max(
+              n_fe_indices, dof_handler[no]->get_fe_collection().size());
+          fe_index_category.resize(n_fe_indices);
+          for (unsigned int i = 0; i < n_fe_indices; ++i)
+            {
+              fe_index_category[i] = i;
+              for (unsigned int j = 0; j < i; ++j)
+                {
+                  if (fe_index_category[j] != j)
+                    continue;
+                  bool identical =
+                    mapping->size() == 1 || &(*mapping)[i] == &(*mapping)[j];
+                  for (const unsigned int no : hp_dof_handler_index)
+                    if (dof_handler[no]->get_fe_collection().size() > 1)
+                      identical = identical && dof_handler[no]->get_fe(i) ==
+                                                 dof_handler[no]->get_fe(j);
+                  for (const auto &q : quad)
+                    identical = identical && (q.size() == 1 || q[i] == q[j]);
+                  if (identical)
+                    {
+                      fe_index_category[i] = j;
+                      break;
+                    }
+                }
+            }
+        }
+
       // set dof_indices together with constraint_indicator and
       // constraint_pool_data. It also reorders the way cells are gone through
       // (to separate cells with overlap to other processors from others
       // without).
-      initialize_indices(constraints, locally_owned_dofs, additional_data);
+      initialize_indices(constraints,
+                         locally_owned_dofs,
+                         additional_data,
+                         fe_index_category);
     }
 
   // initialize bare structures
@@ -854,11 +909,15 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.cell_geometry_on_the_fly);
 
       mapping_is_initialized = true;
     }
 
+  if (additional_data.tune_cell_kernels && mapping_is_initialized)
+    tune_cell_kernels();
+
   // set up map: deal.II index -> MatrixFree index
   {
     const auto &tria     = dof_handler[0]->get_triangulation();
@@ -913,6 +972,185 @@ MatrixFree<dim, Number, VectorizedArrayType>::update_mapping(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::tune_cell_kernels()
+{
+  using namespace internal::MatrixFreeFunctions;
+
+  // The configurations that can run with either variant are characterized
+  // by the element type, the polynomial degree, and the number of quadrature
+  // points per direction
+  using Key = std::array<unsigned int, 3>;
+
+  const auto has_variants = [](const ShapeInfo<Number> &info) {
+    return (info.element_type == tensor_symmetric ||
+            info.element_type == tensor_symmetric_hermite) &&
+           info.data.size() == 1 &&
+           info.data[0].n_q_points_1d > info.data[0].fe_degree &&
+           info.data[0].n_q_points_1d < 200;
+  };
+  const auto get_key = [](const ShapeInfo<Number> &info) -> Key {
+    return {{static_cast<unsigned int>(info.element_type),
+             info.data[0].fe_degree,
+             info.data[0].n_q_points_1d}};
+  };
+  const auto set_variant = [&](const Key               &key,
+                               const CellKernelVariant variant) {
+    for (unsigned int i = 0; i < shape_info.size(0); ++i)
+      for (unsigned int j = 0; j < shape_info.size(1); ++j)
+        for (unsigned int k = 0; k < shape_info.size(2); ++k)
+          for (unsigned int l = 0; l < shape_info.size(3); ++l)
+            {
+              ShapeInfo<Number> &info = shape_info(i, j, k, l);
+              if (has_variants(info) && get_key(info) == key)
+                info.cell_kernel_variant = variant;
+            }
+  };
+
+  std::set<Key> keys;
+  for (unsigned int i = 0; i < shape_info.size(0); ++i)
+    for (unsigned int j = 0; j < shape_info.size(1); ++j)
+      for (unsigned int k = 0; k < shape_info.size(2); ++k)
+        for (unsigned int l = 0; l < shape_info.size(3); ++l)
+          if (has_variants(shape_info(i, j, k, l)))
+            keys.insert(get_key(shape_info(i, j, k, l)));
+
+  // The choices are cached in this object for subsequent calls to reinit().
+  // As the timings are accumulated over all processes of the communicator,
+  // we repeat them for all configurations if one of the processes has not
+  // seen one of them before, to make sure that all processes participate in
+  // the same collective operations.
+  unsigned int n_missing = 0;
+  for (const Key &key : keys)
+    if (tuned_cell_kernel_variants.find(key) ==
+        tuned_cell_kernel_variants.end())
+      ++n_missing;
+  if (Utilities::MPI::max(n_missing, task_info.communicator) > 0)
+    {
+      std::vector<unsigned int> first_batch_of_fe_index(
+        n_active_fe_indices(), numbers::invalid_unsigned_int);
+      for (unsigned int batch = 0; batch < n_cell_batches(); ++batch)
+        {
+          unsigned int &entry =
+            first_batch_of_fe_index[get_cell_active_fe_index({batch,
+                                                              batch + 1})];
+          if (entry == numbers::invalid_unsigned_int)
+            entry = batch;
+        }
+
+      // Time the evaluation of values and gradients followed by the
+      // integration with the two variants on the first cell batch that uses
+      // the given configuration, taking the best of several trials to reduce
+      // the noise. Processes without such a cell batch contribute zero.
+      std::vector<double> local_timings(2 * keys.size(), 0.);
+
+      const auto time_cell_kernels = [&](const Key         &key,
+                                         const unsigned int dof_no,
+                                         const unsigned int quad_no,
+                                         const unsigned int first_component,
+                                         const unsigned int batch,
+                                         const unsigned int key_index) {
+        FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+          *this, {batch, batch + 1}, dof_no, quad_no, first_component);
+        if (!has_variants(phi.get_shape_info()) ||
+            get_key(phi.get_shape_info()) != key)
+          return false;
+
+        phi.reinit(batch);
+        AlignedVector<VectorizedArrayType> dof_values(phi.dofs_per_cell);
+        for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+          dof_values[i] = 0.01 * (i % 17) - 0.05;
+        const unsigned int n_repetitions =
+          1 + 100000 / (phi.dofs_per_cell + phi.n_q_points);
+        const EvaluationFlags::EvaluationFlags flags =
+          EvaluationFlags::values | EvaluationFlags::gradients;
+
+        for (unsigned int v = 0; v < 2; ++v)
+          {
+            set_variant(key,
+                        v == 0 ? CellKernelVariant::direct :
+                                 CellKernelVariant::collocation);
+            double best_time = std::numeric_limits<double>::max();
+            for (unsigned int trial = 0; trial < 5; ++trial)
+              {
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int r = 0; r < n_repetitions; ++r)
+                  {
+                    std::copy(dof_values.begin(),
+                              dof_values.end(),
+                              phi.begin_dof_values());
+                    phi.evaluate(flags);
+                    phi.integrate(flags);
+                  }
+                best_time =
+                  std::min(best_time,
+                           std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count());
+              }
+            local_timings[2 * key_index + v] = best_time;
+          }
+        return true;
+      };
+
+      unsigned int key_index = 0;
+      for (const Key &key : keys)
+        {
+          bool found = false;
+          for (unsigned int no = 0; no < dof_info.size() && !found; ++no)
+            {
+              const FiniteElement<dim> &fe = dof_handlers[no]->get_fe(0);
+
+              unsigned int first_component = 0;
+              for (unsigned int b = 0; b < fe.n_base_elements() && !found; ++b)
+                {
+                  if (fe.base_element(b).n_components() == 1)
+                    for (unsigned int q = 0; q < shape_info.size(1) && !found;
+                         ++q)
+                      for (const unsigned int batch : first_batch_of_fe_index)
+                        if (batch != numbers::invalid_unsigned_int && !found)
+                          found = time_cell_kernels(
+                            key, no, q, first_component, batch, key_index);
+                  first_component += fe.element_multiplicity(b) *
+                                     fe.base_element(b).n_components();
+                }
+            }
+          ++key_index;
+        }
+
+      std::vector<double> timings(local_timings.size());
+      Utilities::MPI::sum(local_timings, task_info.communicator, timings);
+
+      // Only deviate from the heuristic choice if the other variant is
+      // clearly faster, to not act on noise
+      key_index = 0;
+      for (const Key &key : keys)
+        {
+          const double time_direct      = timings[2 * key_index];
+          const double time_collocation = timings[2 * key_index + 1];
+          const bool   heuristic_collocation =
+            internal::use_collocation_evaluation(key[1], key[2]);
+
+          bool use_collocation = heuristic_collocation;
+          if (heuristic_collocation && time_direct < 0.95 * time_collocation)
+            use_collocation = false;
+          else if (!heuristic_collocation &&
+                   time_collocation < 0.95 * time_direct)
+            use_collocation = true;
+          tuned_cell_kernel_variants[key] = use_collocation ?
+                                              CellKernelVariant::collocation :
+                                              CellKernelVariant::direct;
+          ++key_index;
+        }
+    }
+
+  for (const Key &key : keys)
+    set_variant(key, tuned_cell_kernel_variants[key]);
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 template <int spacedim>
 bool
@@ -950,6 +1188,48 @@ namespace internal
           ghost_cell_its.emplace_back(cell->level(), cell->index());
         }
     }
+
+
+
+    // sorts the given cells along a Hilbert curve through the cell centers,
+    // which places cells sharing vertices, edges and faces close to each
+    // other in the list also across the boundaries of coarse cells and for
+    // the cells of a multigrid level
+    template <int dim>
+    void
+    sort_cells_along_hilbert_curve(
+      const dealii::Triangulation<dim>                   &tria,
+      std::vector<std::pair<unsigned int, unsigned int>> &cells)
+    {
+      if (cells.size() < 2)
+        return;
+
+      std::vector<Point<dim>> centers;
+      centers.reserve(cells.size());
+      for (const auto &[level, index] : cells)
+        centers.push_back(
+          typename dealii::Triangulation<dim>::cell_iterator(&tria,
+                                                             level,
+                                                             index)
+            ->center());
+
+      const std::vector<std::array<std::uint64_t, dim>> hilbert_indices =
+        Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+      std::vector<unsigned int> permutation(cells.size());
+      std::iota(permutation.begin(), permutation.end(), 0U);
+      std::stable_sort(permutation.begin(),
+                       permutation.end(),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return hilbert_indices[a] < hilbert_indices[b];
+                       });
+
+      std::vector<std::pair<unsigned int, unsigned int>> sorted_cells;
+      sorted_cells.reserve(cells.size());
+      for (const unsigned int i : permutation)
+        sorted_cells.push_back(cells[i]);
+      cells.swap(sorted_cells);
+    }
   } // namespace MatrixFreeFunctions
 } // namespace internal
 
@@ -987,6 +1267,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
                                                     ghosted_cell_index);
 
       Assert(task_info.n_procs > 1 ||
+               additional_data.communicator != MPI_COMM_NULL ||
                cell_level_index.size() == tria.n_active_cells(),
              ExcInternalError());
     }
@@ -1005,6 +1286,14 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
         }
     }
 
+  if (additional_data.order_cells_along_hilbert_curve)
+    {
+      internal::MatrixFreeFunctions::sort_cells_along_hilbert_curve(
+        tria, cell_level_index);
+      internal::MatrixFreeFunctions::sort_cells_along_hilbert_curve(
+        tria, ghosted_cell_index);
+    }
+
   // All these are cells local to this processor. Therefore, set
   // cell_level_index_end_local to the size of cell_level_index.
   cell_level_index_end_local = cell_level_index.size();
@@ -1156,6 +1445,7 @@ namespace internal
     const bool                       hold_all_faces_to_owned_cells,
     const std::vector<unsigned int> &cell_vectorization_category,
     const bool                       cell_vectorization_categories_strict,
+    const std::vector<unsigned int> &fe_index_category,
     const bool                       do_face_integrals,
     const bool                       build_inner_faces,
     const bool                       overlap_communication_computation,
@@ -1389,7 +1679,9 @@ namespace internal
                 const unsigned int dofs_per_cell =
                   dof_info[no].dofs_per_cell[fe_index];
                 if (dofh.get_fe_collection().size() > 1)
-                  dof_info[no].cell_active_fe_index[counter] = fe_index;
+                  dof_info[no].cell_active_fe_index[counter] =
+                    fe_index_category.empty() ? fe_index :
+                                                fe_index_category[fe_index];
                 else if (cell_categorization_enabled)
                   {
                     AssertIndexRange(cell_it->active_cell_index(),
@@ -1902,7 +2194,8 @@ void
 MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
   const std::vector<const AffineConstraints<number2> *> &constraint,
   const std::vector<IndexSet>                           &locally_owned_dofs,
-  const AdditionalData                                  &additional_data)
+  const AdditionalData                                  &additional_data,
+  const std::vector<unsigned int>                       &fe_index_category)
 {
   // insert possible ghost cells and construct face topology
   const bool do_face_integrals =
@@ -1964,6 +2257,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
     additional_data.hold_all_faces_to_owned_cells,
     additional_data.cell_vectorization_category,
     additional_data.cell_vectorization_categories_strict,
+    fe_index_category,
     do_face_integrals,
     additional_data.mapping_update_flags_inner_faces != update_default,
     overlap_communication_computation,
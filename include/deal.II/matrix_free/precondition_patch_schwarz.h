@@ -0,0 +1,673 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_precondition_patch_schwarz_h
+#define dealii_matrix_free_precondition_patch_schwarz_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <cmath>
+#include <memory>
+#include <set>
+#include <tuple>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A matrix-free additive Schwarz preconditioner with cell patches for the
+ * (shifted) Laplace operator discretized with scalar FE_Q elements. On each
+ * cell, the operator is approximated by the separable operator
+ * @f[
+ *   A_c = \sum_{d=0}^{dim-1} M_{dim-1} \otimes \ldots \otimes
+ *         \left(K_d + \frac{\alpha}{dim} M_d\right) \otimes \ldots
+ *         \otimes M_0,
+ * @f]
+ * where $M_d$ and $K_d$ are the 1d mass and stiffness matrices on an
+ * axis-parallel box of the size of the cell, as created by
+ * TensorProductMatrixCreator::create_laplace_tensor_product_matrix(), and
+ * $\alpha$ is the coefficient of a mass term. Along directions with a
+ * neighbor, the matrices include the contribution of the neighbor to the DoFs
+ * on the shared face, so that the cell matrices approximate the rows of the
+ * global matrix. The inverse of the cell matrices is applied with the fast
+ * diagonalization method of TensorProductMatrixSymmetricSumCollection at a
+ * cost of $\mathcal O(k^{d+1})$ per cell for degree $k$, the same cost as
+ * the matrix-free operator evaluation.
+ *
+ * The action of the preconditioner is
+ * @f[
+ *   P^{-1} = \sum_{c} R_c^T W_c A_c^{-1} W_c R_c,
+ * @f]
+ * where $R_c$ reads the DoFs of cell $c$ (resolving the constraints of the
+ * MatrixFree object) and $W_c$ optionally scales each DoF by the inverse
+ * square root of the number of cells it belongs to, which keeps the
+ * preconditioner symmetric and the sum over overlapping DoFs of the right
+ * size. Applied in a MatrixFree::cell_loop(), the preconditioner is
+ * thread-parallel and overlaps the ghost exchange with the computations in
+ * the same way as the matrix-free operator.
+ *
+ * Since the class provides vmult() and Tvmult(), it can be used as the
+ * inner preconditioner of PreconditionChebyshev, which is the typical way to
+ * use it as a multigrid smoother with MGSmootherPrecondition:
+ * @code
+ * using SmootherType =
+ *   PreconditionChebyshev<LevelMatrixType,
+ *                         VectorType,
+ *                         PreconditionPatchSchwarz<dim, degree>>;
+ * MGLevelObject<typename SmootherType::AdditionalData> smoother_data(min, max);
+ * for (unsigned int level = min; level <= max; ++level)
+ *   {
+ *     auto preconditioner =
+ *       std::make_shared<PreconditionPatchSchwarz<dim, degree>>();
+ *     preconditioner->initialize(*level_matrix_free[level]);
+ *     smoother_data[level].preconditioner = preconditioner;
+ *     smoother_data[level].smoothing_range = 15.;
+ *     smoother_data[level].degree          = 3;
+ *   }
+ * MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType> smoother;
+ * smoother.initialize(level_matrices, smoother_data);
+ * @endcode
+ * Compared to point-Jacobi, the cell-wise inverses capture the coupling
+ * within the cells, which becomes dominant at high polynomial degrees.
+ *
+ * @note The cell matrices are based on the vertex positions of the cells,
+ * i.e., on an affine approximation of the geometry. On strongly deformed or
+ * curved cells, the preconditioner remains symmetric and positive definite
+ * but becomes less effective.
+ */
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d            = fe_degree + 1,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class PreconditionPatchSchwarz : public EnableObserverPointer
+{
+public:
+  /**
+   * Vector type the preconditioner works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Value type, as expected by PreconditionChebyshev and friends.
+   */
+  using value_type = Number;
+
+  /**
+   * Size type.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Parameters of the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const std::set<types::boundary_id> &dirichlet_boundary_ids = {},
+      const double                        mass_coefficient       = 0.,
+      const bool                          weight_overlap         = true,
+      const unsigned int                  dof_handler_index      = 0,
+      const unsigned int                  quadrature_index       = 0)
+      : dirichlet_boundary_ids(dirichlet_boundary_ids)
+      , mass_coefficient(mass_coefficient)
+      , weight_overlap(weight_overlap)
+      , dof_handler_index(dof_handler_index)
+      , quadrature_index(quadrature_index)
+    {}
+
+    /**
+     * The boundary ids with Dirichlet conditions. The DoFs on these
+     * boundaries are removed from the cell matrices, whereas all other
+     * boundaries are treated as Neumann boundaries.
+     */
+    std::set<types::boundary_id> dirichlet_boundary_ids;
+
+    /**
+     * The coefficient $\alpha$ of the mass term in the operator
+     * $-\Delta + \alpha$ approximated on the cells.
+     */
+    double mass_coefficient;
+
+    /**
+     * If set, the input and output of the cell inverses are scaled by the
+     * inverse square root of the number of cells a DoF belongs to.
+     * Otherwise, the contributions of the cells are simply added.
+     */
+    bool weight_overlap;
+
+    /**
+     * Index of the DoFHandler within MatrixFree to be used.
+     */
+    unsigned int dof_handler_index;
+
+    /**
+     * Index of the quadrature formula within MatrixFree to be used. The
+     * quadrature formula does not enter the cell matrices, but it is needed
+     * to set up the FEEvaluation object.
+     */
+    unsigned int quadrature_index;
+  };
+
+  /**
+   * Set up the cell matrices for all cells of @p matrix_free and compute
+   * their eigendecompositions.
+   */
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, overwriting the content of @p dst.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the preconditioner is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the number of rows of the preconditioner.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the preconditioner.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the memory consumption of this class in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The type of the collection of the cell inverses.
+   */
+  using CellInverseType = TensorProductMatrixSymmetricSumCollection<
+    dim,
+    VectorizedArrayType,
+    (fe_degree == -1) ? -1 : fe_degree + 1>;
+
+  /**
+   * Compute the 1d matrices of the cells in a cell batch from the reference
+   * matrices and add them to the collection.
+   */
+  void
+  setup_cell_batch(const unsigned int cell_batch_index);
+
+  /**
+   * Apply the inverse of the cell matrices on a range of cell batches.
+   */
+  void
+  local_apply_inverse(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &dst,
+    const VectorType                                   &src,
+    const std::pair<unsigned int, unsigned int>        &cell_range) const;
+
+  /**
+   * Pointer to the underlying MatrixFree object.
+   */
+  ObserverPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+    matrix_free;
+
+  /**
+   * The parameters passed to initialize().
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The 1d mass matrix on the unit interval in lexicographic numbering,
+   * which is scaled by the cell extents in setup_cell_batch().
+   */
+  FullMatrix<Number> reference_mass_matrix;
+
+  /**
+   * The 1d stiffness matrix on the unit interval in lexicographic
+   * numbering, which is scaled by the cell extents in setup_cell_batch().
+   */
+  FullMatrix<Number> reference_stiffness_matrix;
+
+  /**
+   * The eigendecompositions of the cell matrices, indexed by the cell
+   * batch.
+   */
+  std::unique_ptr<CellInverseType> cell_inverses;
+
+  /**
+   * The inverse square root of the number of cells each DoF belongs to.
+   * Empty if AdditionalData::weight_overlap is not set.
+   */
+  VectorType overlap_weights;
+
+  /**
+   * Temporary vector for the weighted input.
+   */
+  mutable VectorType weighted_src;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const AdditionalData                               &data)
+{
+  clear();
+
+  this->matrix_free     = &matrix_free;
+  this->additional_data = data;
+
+  const FiniteElement<dim> &fe =
+    matrix_free.get_dof_handler(additional_data.dof_handler_index).get_fe();
+  AssertThrow(dynamic_cast<const FE_Q<dim> *>(&fe) != nullptr,
+              ExcMessage("PreconditionPatchSchwarz is only implemented for "
+                         "scalar FE_Q elements."));
+  Assert(fe_degree == -1 || static_cast<unsigned int>(fe_degree) == fe.degree,
+         ExcDimensionMismatch(fe_degree, fe.degree));
+
+  // the 1d matrices on the reference cell are the same for all cells, so
+  // compute them once and only scale them by the extent of each cell
+  std::tie(reference_mass_matrix, reference_stiffness_matrix, std::ignore) =
+    TensorProductMatrixCreator::internal::
+      create_reference_mass_and_stiffness_matrices<Number>(
+        FE_Q<1>(fe.degree), QGauss<1>(fe.degree + 1));
+
+  cell_inverses = std::make_unique<CellInverseType>();
+  cell_inverses->reserve(matrix_free.n_cell_batches());
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    setup_cell_batch(cell);
+  cell_inverses->finalize();
+
+  if (additional_data.weight_overlap)
+    {
+      matrix_free.initialize_dof_vector(overlap_weights,
+                                        additional_data.dof_handler_index);
+      FEEvaluation<dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   1,
+                   Number,
+                   VectorizedArrayType>
+        phi(matrix_free,
+            additional_data.dof_handler_index,
+            additional_data.quadrature_index);
+      for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+        {
+          phi.reinit(cell);
+          for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+            phi.begin_dof_values()[i] = VectorizedArrayType(1.);
+          phi.distribute_local_to_global(overlap_weights);
+        }
+      overlap_weights.compress(VectorOperation::add);
+
+      for (Number &weight : overlap_weights)
+        weight = (weight > Number()) ? Number(1.) / std::sqrt(weight) :
+                                       Number();
+      weighted_src.reinit(overlap_weights);
+    }
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::
+  setup_cell_batch(const unsigned int cell_batch_index)
+{
+  using LaplaceBoundaryType = TensorProductMatrixCreator::LaplaceBoundaryType;
+
+  const FullMatrix<Number> &M_ref     = reference_mass_matrix;
+  const FullMatrix<Number> &K_ref     = reference_stiffness_matrix;
+  const unsigned int        n_dofs_1d = M_ref.m();
+
+  const auto face_distance = [](const auto &cell, const unsigned int face) {
+    return cell->face(face)->center().distance(cell->face(face ^ 1)->center());
+  };
+
+  std::array<Table<2, VectorizedArrayType>, dim> Ms;
+  std::array<Table<2, VectorizedArrayType>, dim> Ks;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      Ms[d].reinit(n_dofs_1d, n_dofs_1d);
+      Ks[d].reinit(n_dofs_1d, n_dofs_1d);
+    }
+
+  FullMatrix<Number> M(n_dofs_1d, n_dofs_1d);
+  FullMatrix<Number> K(n_dofs_1d, n_dofs_1d);
+
+  for (unsigned int v = 0;
+       v < matrix_free->n_active_entries_per_cell_batch(cell_batch_index);
+       ++v)
+    {
+      const auto cell =
+        matrix_free->get_cell_iterator(cell_batch_index,
+                                       v,
+                                       additional_data.dof_handler_index);
+
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          // the matrices of the cell itself, following
+          // TensorProductMatrixCreator::create_laplace_tensor_product_matrix()
+          // with an overlap of one DoF
+          const double h = face_distance(cell, 2 * d);
+          for (unsigned int i = 0; i < n_dofs_1d; ++i)
+            for (unsigned int j = 0; j < n_dofs_1d; ++j)
+              {
+                M(i, j) = M_ref(i, j) * h;
+                K(i, j) = K_ref(i, j) / h;
+              }
+
+          // add the contribution of the neighbors to the DoFs on the shared
+          // faces, or eliminate the DoFs on Dirichlet boundaries
+          for (unsigned int side = 0; side < 2; ++side)
+            {
+              const unsigned int face = 2 * d + side;
+              const unsigned int i0   = side == 0 ? 0 : n_dofs_1d - 1;
+
+              LaplaceBoundaryType boundary_type;
+              if (cell->at_boundary(face) == false ||
+                  cell->has_periodic_neighbor(face))
+                boundary_type = LaplaceBoundaryType::internal_boundary;
+              else
+                boundary_type = additional_data.dirichlet_boundary_ids.count(
+                                  cell->face(face)->boundary_id()) > 0 ?
+                                  LaplaceBoundaryType::dirichlet :
+                                  LaplaceBoundaryType::neumann;
+
+              if (boundary_type == LaplaceBoundaryType::internal_boundary)
+                {
+                  const bool periodic = cell->has_periodic_neighbor(face);
+                  const auto neighbor =
+                    periodic ? cell->periodic_neighbor(face) :
+                               cell->neighbor(face);
+                  const unsigned int neighbor_face =
+                    periodic ? cell->periodic_neighbor_face_no(face) :
+                               cell->neighbor_face_no(face);
+                  const double h_neighbor =
+                    face_distance(neighbor, neighbor_face);
+
+                  // the DoF on the face is the last one of the left neighbor
+                  // and the first one of the right neighbor
+                  const unsigned int i1 = n_dofs_1d - 1 - i0;
+                  M(i0, i0) += M_ref(i1, i1) * h_neighbor;
+                  K(i0, i0) += K_ref(i1, i1) / h_neighbor;
+                }
+              else if (boundary_type == LaplaceBoundaryType::dirichlet)
+                for (unsigned int i = 0; i < n_dofs_1d; ++i)
+                  {
+                    M(i, i0) = M(i0, i) = 0.;
+                    K(i, i0) = K(i0, i) = 0.;
+                  }
+            }
+
+          // the mass term is split evenly among the directions, which gives
+          // alpha M x M x M in the sum over the tensor products
+          for (unsigned int i = 0; i < n_dofs_1d; ++i)
+            for (unsigned int j = 0; j < n_dofs_1d; ++j)
+              {
+                Ms[d][i][j][v] = M(i, j);
+                Ks[d][i][j][v] =
+                  K(i, j) + additional_data.mass_coefficient / dim * M(i, j);
+              }
+        }
+    }
+
+  cell_inverses->insert(cell_batch_index, Ms, Ks);
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::clear()
+{
+  matrix_free = nullptr;
+  reference_mass_matrix.reinit(0, 0);
+  reference_stiffness_matrix.reinit(0, 0);
+  cell_inverses.reset();
+  overlap_weights.reinit(0);
+  weighted_src.reinit(0);
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::vmult(VectorType       &dst,
+                                                     const VectorType &src)
+  const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+
+  if (additional_data.weight_overlap)
+    {
+      weighted_src.copy_locally_owned_data_from(src);
+      weighted_src.scale(overlap_weights);
+      matrix_free->cell_loop(&PreconditionPatchSchwarz::local_apply_inverse,
+                             this,
+                             dst,
+                             weighted_src,
+                             true);
+      dst.scale(overlap_weights);
+    }
+  else
+    matrix_free->cell_loop(
+      &PreconditionPatchSchwarz::local_apply_inverse, this, dst, src, true);
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::Tvmult(VectorType       &dst,
+                                                      const VectorType &src)
+  const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+typename PreconditionPatchSchwarz<dim,
+                                  fe_degree,
+                                  n_q_points_1d,
+                                  Number,
+                                  VectorizedArrayType>::size_type
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::m() const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+  return matrix_free->get_vector_partitioner(additional_data.dof_handler_index)
+    ->size();
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+typename PreconditionPatchSchwarz<dim,
+                                  fe_degree,
+                                  n_q_points_1d,
+                                  Number,
+                                  VectorizedArrayType>::size_type
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::n() const
+{
+  return m();
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+std::size_t
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::memory_consumption() const
+{
+  return (cell_inverses ? cell_inverses->memory_consumption() : 0) +
+         reference_mass_matrix.memory_consumption() +
+         reference_stiffness_matrix.memory_consumption() +
+         overlap_weights.memory_consumption() +
+         weighted_src.memory_consumption();
+}
+
+
+
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+PreconditionPatchSchwarz<dim,
+                         fe_degree,
+                         n_q_points_1d,
+                         Number,
+                         VectorizedArrayType>::
+  local_apply_inverse(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType                                         &dst,
+    const VectorType                                   &src,
+    const std::pair<unsigned int, unsigned int>        &cell_range) const
+{
+  FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number, VectorizedArrayType>
+    phi(matrix_free,
+        additional_data.dof_handler_index,
+        additional_data.quadrature_index);
+
+  AlignedVector<VectorizedArrayType> cell_src(phi.dofs_per_cell);
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+        cell_src[i] = phi.begin_dof_values()[i];
+
+      cell_inverses->apply_inverse(
+        cell,
+        make_array_view(phi.begin_dof_values(),
+                        phi.begin_dof_values() + phi.dofs_per_cell),
+        make_array_view(cell_src.begin(), cell_src.end()));
+
+      phi.distribute_local_to_global(dst);
+    }
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
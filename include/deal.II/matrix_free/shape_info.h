@@ -126,6 +126,44 @@ namespace internal
 
 
 
+    /**
+     * An enum that selects between the two code paths that FEEvaluation
+     * provides for the evaluation and integration on cells for elements of
+     * type ElementType::tensor_symmetric and
+     * ElementType::tensor_symmetric_hermite with more quadrature points than
+     * degrees of freedom per direction: The direct path interpolates between
+     * the degrees of freedom and the quadrature points and computes the
+     * derivatives with the even-odd decomposition of the 1d shape functions
+     * in each direction, whereas the collocation path first transforms the
+     * degrees of freedom to the nodal basis in the quadrature points and
+     * computes the derivatives in that basis. Which of the two is faster
+     * depends on the polynomial degree, the number of quadrature points, the
+     * vectorization width, and the machine.
+     */
+    enum class CellKernelVariant : unsigned char
+    {
+      /**
+       * Select the code path with the heuristic based on operation counts
+       * in the function internal::use_collocation_evaluation().
+       */
+      heuristic,
+
+      /**
+       * Use the direct path without transformation to the collocation
+       * space.
+       */
+      direct,
+
+      /**
+       * Use the path with transformation to the collocation space. This
+       * variant must only be selected if the number of quadrature points per
+       * direction exceeds the number of degrees of freedom per direction.
+       */
+      collocation
+    };
+
+
+
     /**
      * This struct stores the shape functions, their gradients and Hessians
      * evaluated for a one-dimensional section of a tensor product finite
@@ -404,6 +442,15 @@ namespace internal
        */
       ElementType element_type;
 
+      /**
+       * The code path used by FEEvaluation for the evaluation and
+       * integration on cells, see CellKernelVariant. It is set to
+       * CellKernelVariant::heuristic by reinit() and can be adjusted
+       * afterwards, e.g. by the timings performed in MatrixFree::reinit()
+       * if MatrixFree::AdditionalData::tune_cell_kernels is set.
+       */
+      CellKernelVariant cell_kernel_variant;
+
       /**
        * Empty constructor. Does nothing.
        */
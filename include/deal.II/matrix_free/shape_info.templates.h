@@ -202,6 +202,7 @@ namespace internal
     template <typename Number>
     ShapeInfo<Number>::ShapeInfo()
       : element_type(tensor_general)
+      , cell_kernel_variant(CellKernelVariant::heuristic)
       , n_dimensions(0)
       , n_components(0)
       , n_q_points(0)
@@ -238,6 +239,8 @@ namespace internal
                               const FiniteElement<dim, spacedim> &fe_in,
                               const unsigned int base_element_number)
     {
+      cell_kernel_variant = CellKernelVariant::heuristic;
+
       // ShapeInfo for RT elements. Here, data is of size 2 instead of 1.
       // data[0] is univariate_shape_data in normal direction and
       // data[1] is univariate_shape_data in tangential direction
@@ -15,6 +15,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/grid/tria.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
@@ -25,9 +28,17 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <numeric>
+
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class SparseMatrix;
+#endif
+
 /**
  * A namespace for utility functions in the context of matrix-free operator
  * evaluation.
@@ -266,6 +277,16 @@ namespace MatrixFreeTools
    * @p matrix_free and the local cell integral operation @p cell_operation.
    * Constrained entries on the diagonal are set to one.
    *
+   * The element matrices are computed in parallel according to the
+   * parallelization scheme of @p matrix_free. If @p matrix_free has been set
+   * up without multithreading, @p matrix is of type SparseMatrix, and more
+   * than one thread is available, the cell batches are instead colored such
+   * that batches of the same color do not write into the same rows of
+   * @p matrix, and the element matrices are computed and scattered into
+   * @p matrix concurrently via WorkStream::run() without locks. In either
+   * case, @p cell_operation must be safe to be called concurrently from
+   * several threads.
+   *
    * The parameters @p dof_handler_index, @p quadrature_index, and @p first_selected_component are
    * passed to the constructor of the FEEvaluation that is internally set up.
    */
@@ -652,6 +673,179 @@ namespace MatrixFreeTools
     unsigned int fe_index_valid;
   };
 
+
+
+  /**
+   * A class that applies several cell operators that act on the same source
+   * vector in a single sweep over the cells of a MatrixFree object. Each
+   * operator is described by a function that works on the quadrature points
+   * of an FEEvaluation object (i.e., calls the get_value()/submit_value()
+   * functions and friends) and by the flags for the evaluation and the
+   * integration step. In cell_loop(), the vector entries of a cell batch are
+   * read and interpolated to the quadrature points only once, with the union
+   * of the evaluation flags of all operators, and the quadrature-point data is
+   * then handed to each operator in turn. The result of operator @p k is
+   * integrated and added into the @p k-th destination vector.
+   *
+   * Compared to separate calls to MatrixFree::cell_loop() for each operator,
+   * this saves the repeated access to the source vector and the repeated
+   * evaluation, and the ghost exchange of the source vector as well as the
+   * compression of the destination vectors are each done in one go. Since
+   * the loop is run through MatrixFree::cell_loop(), the overlap of
+   * communication and computation and the threading of the loop are the same
+   * as for a single operator.
+   *
+   * A typical use, e.g. in a time integrator that needs both the action of
+   * the mass matrix and the stiffness matrix on the same vector, is
+   * @code
+   * MatrixFreeTools::FusedCellOperators<dim, degree> fused_operators;
+   * fused_operators.reinit(matrix_free);
+   * fused_operators.add_operator(EvaluationFlags::values,
+   *                              EvaluationFlags::values,
+   *                              [](auto &phi) {
+   *                                for (const unsigned int q :
+   *                                     phi.quadrature_point_indices())
+   *                                  phi.submit_value(phi.get_value(q), q);
+   *                              });
+   * fused_operators.add_operator(EvaluationFlags::gradients,
+   *                              EvaluationFlags::gradients,
+   *                              [](auto &phi) {
+   *                                for (const unsigned int q :
+   *                                     phi.quadrature_point_indices())
+   *                                  phi.submit_gradient(phi.get_gradient(q),
+   *                                                      q);
+   *                              });
+   *
+   * std::vector<VectorType *> dst = {&mass_times_src, &laplace_times_src};
+   * fused_operators.cell_loop(dst, src, true);
+   * @endcode
+   *
+   * @note The operators must not modify the data of the FEEvaluation object
+   * other than through the submit functions, and must not call
+   * FEEvaluation::reinit(), as the object is shared between the operators.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d            = fe_degree + 1,
+            int n_components             = 1,
+            typename Number              = double,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class FusedCellOperators
+  {
+  public:
+    /**
+     * The type of the FEEvaluation object passed to the operators.
+     */
+    using FEEvaluationType = FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          Number,
+                                          VectorizedArrayType>;
+
+    /**
+     * The type of the function describing the work of an operator on the
+     * quadrature points of a cell batch.
+     */
+    using QuadratureOperation = std::function<void(FEEvaluationType &)>;
+
+    /**
+     * Set the MatrixFree object and the components of it to be used for the
+     * FEEvaluation object. The parameters @p dof_handler_index,
+     * @p quadrature_index, and @p first_selected_component have the same
+     * meaning as in the constructor of FEEvaluation. The operators added so
+     * far are kept.
+     */
+    void
+    reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+           const unsigned int dof_handler_index        = 0,
+           const unsigned int quadrature_index         = 0,
+           const unsigned int first_selected_component = 0);
+
+    /**
+     * Add an operator given by the action @p quadrature_operation on the
+     * quadrature points, which reads the quantities selected by
+     * @p evaluation_flags and submits the quantities selected by
+     * @p integration_flags. Returns the index of the operator, which is the
+     * index of the destination vector the operator writes into in
+     * cell_loop().
+     */
+    unsigned int
+    add_operator(const EvaluationFlags::EvaluationFlags evaluation_flags,
+                 const EvaluationFlags::EvaluationFlags integration_flags,
+                 const QuadratureOperation             &quadrature_operation);
+
+    /**
+     * Return the number of operators added by add_operator().
+     */
+    unsigned int
+    n_operators() const;
+
+    /**
+     * Remove all operators.
+     */
+    void
+    clear_operators();
+
+    /**
+     * Loop over all cells, apply all operators to @p src, and add the result
+     * of the @p k-th operator into <tt>*dst[k]</tt>. If @p zero_dst_vectors
+     * is set, the destination vectors are set to zero within the loop, see
+     * MatrixFree::cell_loop().
+     */
+    template <typename VectorType>
+    void
+    cell_loop(std::vector<VectorType *> &dst,
+              const VectorType          &src,
+              const bool                 zero_dst_vectors = false) const;
+
+    /**
+     * Same as above, but with the destination vectors stored by value.
+     */
+    template <typename VectorType>
+    void
+    cell_loop(std::vector<VectorType> &dst,
+              const VectorType        &src,
+              const bool               zero_dst_vectors = false) const;
+
+  private:
+    /**
+     * Pointer to the underlying MatrixFree object.
+     */
+    ObserverPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+      matrix_free;
+
+    /**
+     * Index of the DoFHandler within MatrixFree to be used.
+     */
+    unsigned int dof_handler_index = 0;
+
+    /**
+     * Index of the quadrature formula within MatrixFree to be used.
+     */
+    unsigned int quadrature_index = 0;
+
+    /**
+     * First component of the underlying finite element to be used.
+     */
+    unsigned int first_selected_component = 0;
+
+    /**
+     * The evaluation flags of the operators.
+     */
+    std::vector<EvaluationFlags::EvaluationFlags> evaluation_flags;
+
+    /**
+     * The integration flags of the operators.
+     */
+    std::vector<EvaluationFlags::EvaluationFlags> integration_flags;
+
+    /**
+     * The actions of the operators on the quadrature points.
+     */
+    std::vector<QuadratureOperation> quadrature_operations;
+  };
+
   // implementations
 
 #ifndef DOXYGEN
@@ -2447,9 +2641,35 @@ namespace MatrixFreeTools
         internal::create_new_affine_constraints_if_needed(
           matrix, constraints_in, constraints_for_matrix);
 
+      // write the element matrices of block column bj of all filled lanes
+      // into the global matrix
+      const auto distribute_block_column =
+        [&constraints, &matrix](const auto        &matrices,
+                                const auto        &dof_indices_mf,
+                                const unsigned int bj,
+                                const unsigned int n_filled_lanes) {
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            for (unsigned int bi = 0; bi < matrices.size(0); ++bi)
+              if (bi == bj)
+                // specialization for blocks on the diagonal to writing into
+                // diagonal elements of the matrix if the corresponding
+                // degree of freedom is constrained, see also the
+                // documentation of
+                // AffineConstraints::distribute_local_to_global()
+                constraints.distribute_local_to_global(matrices[bi][bi][v],
+                                                       dof_indices_mf[bi][v],
+                                                       matrix);
+              else
+                constraints.distribute_local_to_global(matrices[bi][bj][v],
+                                                       dof_indices_mf[bi][v],
+                                                       dof_indices_mf[bj][v],
+                                                       matrix);
+        };
+
       const auto batch_operation =
-        [&matrix_free, &constraints, &matrix](
-          auto &data, const std::pair<unsigned int, unsigned int> &range) {
+        [&matrix_free](auto                                        &data,
+                       const std::pair<unsigned int, unsigned int> &range,
+                       const auto &process_block_column) {
           if (!data.op_compute)
             return; // nothing to do
 
@@ -2568,41 +2788,135 @@ namespace MatrixFreeTools
                               phi[bi]->begin_dof_values()[i][v];
                     }
 
-                  for (unsigned int v = 0; v < n_filled_lanes; ++v)
-                    for (unsigned int bi = 0; bi < n_blocks; ++bi)
-                      if (bi == bj)
-                        // specialization for blocks on the diagonal
-                        // to writing into diagonal elements of the
-                        // matrix if the corresponding degree of freedom
-                        // is constrained, see also the documentation
-                        // of AffineConstraints::distribute_local_to_global()
-                        constraints.distribute_local_to_global(
-                          matrices[bi][bi][v], dof_indices_mf[bi][v], matrix);
-                      else
-                        constraints.distribute_local_to_global(
-                          matrices[bi][bj][v],
-                          dof_indices_mf[bi][v],
-                          dof_indices_mf[bj][v],
-                          matrix);
+                  process_block_column(matrices,
+                                       dof_indices_mf,
+                                       bj,
+                                       n_filled_lanes);
                 }
             }
         };
 
       const auto cell_operation_wrapped =
         [&](const auto &, auto &, const auto &, const auto range) {
-          batch_operation(data_cell, range);
+          batch_operation(data_cell, range, distribute_block_column);
         };
 
       const auto face_operation_wrapped =
         [&](const auto &, auto &, const auto &, const auto range) {
-          batch_operation(data_face, range);
+          batch_operation(data_face, range, distribute_block_column);
         };
 
       const auto boundary_operation_wrapped =
         [&](const auto &, auto &, const auto &, const auto range) {
-          batch_operation(data_boundary, range);
+          batch_operation(data_boundary, range, distribute_block_column);
         };
 
+      // If the MatrixFree object runs in serial and only cell integrals are
+      // requested, compute the element matrices in parallel with
+      // WorkStream. The cell batches are colored such that no two batches
+      // of the same color write into the same row of the matrix (including
+      // the rows reached through constraints), which allows to scatter the
+      // element matrices of one color concurrently without locks. This is
+      // only done for SparseMatrix, whose rows can be written independently
+      // by several threads.
+      if constexpr (std::is_same_v<
+                      MatrixType,
+                      SparseMatrix<typename MatrixType::value_type>>)
+        if (!data_face.op_compute && !data_boundary.op_compute &&
+            data_cell.op_compute && MultithreadInfo::n_threads() > 1 &&
+            matrix_free.n_cell_batches() > 0 &&
+            matrix_free.get_task_info().scheme ==
+              dealii::internal::MatrixFreeFunctions::TaskInfo::none)
+          {
+            using MatrixTable = Table<
+              2,
+              std::array<FullMatrix<typename MatrixType::value_type>,
+                         VectorizedArrayType::size()>>;
+            using IndexTable = Table<2, std::vector<types::global_dof_index>>;
+
+            struct ScratchData
+            {};
+
+            struct CopyData
+            {
+              MatrixTable  matrices;
+              IndexTable   dof_indices_mf;
+              unsigned int n_filled_lanes = 0;
+            };
+
+            std::vector<unsigned int> batches(matrix_free.n_cell_batches());
+            std::iota(batches.begin(), batches.end(), 0U);
+
+            using Iterator = std::vector<unsigned int>::const_iterator;
+
+            const auto get_conflict_indices = [&](const Iterator &batch) {
+              std::vector<types::global_dof_index> conflict_indices;
+              std::vector<types::global_dof_index> dof_indices;
+              for (unsigned int v = 0;
+                   v < matrix_free.n_active_entries_per_cell_batch(*batch);
+                   ++v)
+                for (const unsigned int dof_no : data_cell.dof_numbers)
+                  {
+                    const auto cell_iterator =
+                      matrix_free.get_cell_iterator(*batch, v, dof_no);
+                    dof_indices.resize(
+                      cell_iterator->get_fe().n_dofs_per_cell());
+                    if (matrix_free.get_mg_level() !=
+                        numbers::invalid_unsigned_int)
+                      cell_iterator->get_mg_dof_indices(dof_indices);
+                    else
+                      cell_iterator->get_dof_indices(dof_indices);
+                    conflict_indices.insert(conflict_indices.end(),
+                                            dof_indices.begin(),
+                                            dof_indices.end());
+                  }
+              constraints.resolve_indices(conflict_indices);
+              return conflict_indices;
+            };
+
+            const std::vector<std::vector<Iterator>> colored_batches =
+              GraphColoring::make_graph_coloring(batches.cbegin(),
+                                                 batches.cend(),
+                                                 get_conflict_indices);
+
+            const auto worker =
+              [&](const Iterator &batch, ScratchData &, CopyData &copy_data) {
+                // keep the element matrices once the last block column has
+                // been computed
+                const auto store_element_matrices =
+                  [&copy_data](const MatrixTable &matrices,
+                               const IndexTable  &dof_indices_mf,
+                               const unsigned int bj,
+                               const unsigned int n_filled_lanes) {
+                    if (bj + 1 == matrices.size(1))
+                      {
+                        copy_data.matrices       = matrices;
+                        copy_data.dof_indices_mf = dof_indices_mf;
+                        copy_data.n_filled_lanes = n_filled_lanes;
+                      }
+                  };
+
+                copy_data.n_filled_lanes = 0;
+                batch_operation(data_cell,
+                                std::make_pair(*batch, *batch + 1),
+                                store_element_matrices);
+              };
+
+            const auto copier = [&](const CopyData &copy_data) {
+              for (unsigned int bj = 0; bj < copy_data.matrices.size(1); ++bj)
+                distribute_block_column(copy_data.matrices,
+                                        copy_data.dof_indices_mf,
+                                        bj,
+                                        copy_data.n_filled_lanes);
+            };
+
+            WorkStream::run(
+              colored_batches, worker, copier, ScratchData(), CopyData());
+
+            matrix.compress(VectorOperation::add);
+            return;
+          }
+
       if (data_face.op_compute || data_boundary.op_compute)
         {
           matrix_free.template loop<MatrixType, MatrixType>(
@@ -2684,6 +2998,241 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::
+    reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+           const unsigned int dof_handler_index,
+           const unsigned int quadrature_index,
+           const unsigned int first_selected_component)
+  {
+    this->matrix_free              = &matrix_free;
+    this->dof_handler_index        = dof_handler_index;
+    this->quadrature_index         = quadrature_index;
+    this->first_selected_component = first_selected_component;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  unsigned int
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::
+    add_operator(const EvaluationFlags::EvaluationFlags evaluation_flags,
+                 const EvaluationFlags::EvaluationFlags integration_flags,
+                 const QuadratureOperation             &quadrature_operation)
+  {
+    Assert((evaluation_flags &
+            ~(EvaluationFlags::values | EvaluationFlags::gradients |
+              EvaluationFlags::hessians)) == 0,
+           ExcMessage("Only EvaluationFlags::values, "
+                      "EvaluationFlags::gradients, and "
+                      "EvaluationFlags::hessians are supported."));
+    Assert(integration_flags != EvaluationFlags::nothing,
+           ExcMessage("An operator needs to integrate at least one quantity."));
+
+    this->evaluation_flags.push_back(evaluation_flags);
+    this->integration_flags.push_back(integration_flags);
+    quadrature_operations.push_back(quadrature_operation);
+
+    return quadrature_operations.size() - 1;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  unsigned int
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::n_operators() const
+  {
+    return quadrature_operations.size();
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::clear_operators()
+  {
+    evaluation_flags.clear();
+    integration_flags.clear();
+    quadrature_operations.clear();
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  template <typename VectorType>
+  void
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::
+    cell_loop(std::vector<VectorType *> &dst,
+              const VectorType          &src,
+              const bool                 zero_dst_vectors) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    AssertDimension(dst.size(), quadrature_operations.size());
+
+    EvaluationFlags::EvaluationFlags union_evaluation_flags =
+      EvaluationFlags::nothing;
+    for (const auto flags : evaluation_flags)
+      union_evaluation_flags |= flags;
+
+    const auto cell_operation =
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          std::vector<VectorType *>                          &dst,
+          const VectorType                                   &src,
+          const std::pair<unsigned int, unsigned int>        &range) {
+        FEEvaluationType phi(matrix_free,
+                             dof_handler_index,
+                             quadrature_index,
+                             first_selected_component);
+
+        // the integration step of an operator overwrites the data at the
+        // quadrature points, so keep a copy of the evaluated quantities to
+        // restore them for the next operator. on general cells, the
+        // evaluation of hessians also fills the gradients
+        const unsigned int n_values    = n_components * phi.n_q_points;
+        const unsigned int n_gradients = n_values * dim;
+        const unsigned int n_hessians  = n_values * (dim * (dim + 1) / 2);
+        const bool         keep_values =
+          (union_evaluation_flags & EvaluationFlags::values) != 0u;
+        const bool keep_gradients =
+          (union_evaluation_flags &
+           (EvaluationFlags::gradients | EvaluationFlags::hessians)) != 0u;
+        const bool keep_hessians =
+          (union_evaluation_flags & EvaluationFlags::hessians) != 0u;
+
+        AlignedVector<VectorizedArrayType> quadrature_data;
+        if (quadrature_operations.size() > 1)
+          quadrature_data.resize_fast(n_values + n_gradients + n_hessians);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            phi.read_dof_values(src);
+            phi.evaluate(union_evaluation_flags);
+
+            if (quadrature_operations.size() > 1)
+              {
+                if (keep_values)
+                  std::copy_n(phi.begin_values(),
+                              n_values,
+                              quadrature_data.begin());
+                if (keep_gradients)
+                  std::copy_n(phi.begin_gradients(),
+                              n_gradients,
+                              quadrature_data.begin() + n_values);
+                if (keep_hessians)
+                  std::copy_n(phi.begin_hessians(),
+                              n_hessians,
+                              quadrature_data.begin() + n_values +
+                                n_gradients);
+              }
+
+            for (unsigned int k = 0; k < quadrature_operations.size(); ++k)
+              {
+                if (k > 0)
+                  {
+                    if (keep_values)
+                      std::copy_n(quadrature_data.begin(),
+                                  n_values,
+                                  phi.begin_values());
+                    if (keep_gradients)
+                      std::copy_n(quadrature_data.begin() + n_values,
+                                  n_gradients,
+                                  phi.begin_gradients());
+                    if (keep_hessians)
+                      std::copy_n(quadrature_data.begin() + n_values +
+                                    n_gradients,
+                                  n_hessians,
+                                  phi.begin_hessians());
+                  }
+
+                quadrature_operations[k](phi);
+                phi.integrate_scatter(integration_flags[k], *dst[k]);
+              }
+          }
+      };
+
+    matrix_free->template cell_loop<std::vector<VectorType *>, VectorType>(
+      cell_operation, dst, src, zero_dst_vectors);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  template <typename VectorType>
+  void
+  FusedCellOperators<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>::
+    cell_loop(std::vector<VectorType> &dst,
+              const VectorType        &src,
+              const bool               zero_dst_vectors) const
+  {
+    std::vector<VectorType *> dst_pointers(dst.size());
+    for (unsigned int k = 0; k < dst.size(); ++k)
+      dst_pointers[k] = &dst[k];
+
+    cell_loop(dst_pointers, src, zero_dst_vectors);
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
@@ -16,14 +16,23 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/index_set.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
 
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 #include <deal.II/lac/linear_operator.h>
+#include <deal.II/lac/sparse_direct.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
 
 #include <deal.II/multigrid/mg_base.h>
 
+#include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 /**
@@ -287,6 +296,212 @@ private:
   LAPACKFullMatrix<number> matrix;
 };
 
+/**
+ * Coarse grid solver by a sparse direct factorization on a single MPI
+ * process.
+ *
+ * On large numbers of processes, the coarse level of a multigrid hierarchy
+ * typically has only a few degrees of freedom per process, and the coarse
+ * solve is dominated by the latency of the global reductions of an
+ * iterative solver. This class instead collects the rows of the coarse
+ * matrix on the first process of the communicator, the root process,
+ * factorizes the matrix once with SparseDirectUMFPACK, and then only needs
+ * to collect the right hand side and distribute the solution in each
+ * application.
+ *
+ * To limit the number of messages the root process has to handle, the data
+ * is collected in two stages: The processes of the communicator are split
+ * into groups of at most AdditionalData::max_group_size consecutive ranks.
+ * The first process of each group, the group leader, gathers the matrix
+ * rows and later the right hand side entries of all processes of its
+ * group. The group leaders form a sub-communicator on which they forward
+ * the data of their groups to the root process, which is the leader of the
+ * first group. Each application of the coarse solver thus amounts to a
+ * gather within the groups and among the group leaders, a forward and
+ * backward substitution on the root process, and the scatter of the
+ * solution along the same two stages in reverse order.
+ *
+ * The matrix can be given by any matrix class that provides access to the
+ * entries of its locally owned rows via `begin(row)` and `end(row)`, such
+ * as SparseMatrix or TrilinosWrappers::SparseMatrix. Only the locally owned
+ * rows of the matrix are accessed on each process, so it is possible to
+ * pass a SparseMatrix of the global size that only contains entries in the
+ * locally owned rows. The vector type needs to provide read access to the
+ * locally owned entries of @p src and write access to the locally owned
+ * entries of @p dst via `operator()` with a global index, as is the case
+ * for LinearAlgebra::distributed::Vector.
+ *
+ * @note This class requires deal.II to be configured with UMFPACK, which is
+ * the case by default through the bundled version of the library.
+ */
+template <typename VectorType = Vector<double>>
+class MGCoarseGridSparseDirect : public MGCoarseGridBase<VectorType>
+{
+public:
+  /**
+   * Collect the options of this class.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int max_group_size = 64);
+
+    /**
+     * The maximal number of processes in a group served by one group leader,
+     * which determines the number of processes on which the matrix is
+     * factorized.
+     */
+    unsigned int max_group_size;
+  };
+
+  /**
+   * Constructor leaving an uninitialized object.
+   */
+  MGCoarseGridSparseDirect() = default;
+
+  /**
+   * The object owns the communicators it creates in initialize() and frees
+   * them in clear(), so copying is not allowed.
+   */
+  MGCoarseGridSparseDirect(const MGCoarseGridSparseDirect &) = delete;
+
+  /**
+   * The object owns the communicators it creates in initialize() and frees
+   * them in clear(), so copying is not allowed.
+   */
+  MGCoarseGridSparseDirect &
+  operator=(const MGCoarseGridSparseDirect &) = delete;
+
+  /**
+   * Destructor.
+   */
+  ~MGCoarseGridSparseDirect() override;
+
+  /**
+   * Collect the locally owned rows @p locally_owned_rows of @p matrix from
+   * all processes of @p communicator on the root process and compute the
+   * factorization there.
+   */
+  template <typename MatrixType>
+  void
+  initialize(const MatrixType     &matrix,
+             const IndexSet       &locally_owned_rows,
+             const MPI_Comm        communicator,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and free the communicators.
+   */
+  void
+  clear();
+
+  /**
+   * Solve the coarse problem with right hand side @p src and return the
+   * solution in the locally owned entries of @p dst.
+   */
+  void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+  /**
+   * Return the number of processes on which the matrix has been factorized,
+   * i.e., one after initialize() has been called and zero otherwise.
+   */
+  unsigned int
+  n_factorizing_processes() const;
+
+private:
+  /**
+   * Return whether the present process is the leader of its group.
+   */
+  bool
+  is_group_leader() const;
+
+  /**
+   * Gather the entries of @p local_data of all processes of the group on the
+   * group leader and forward them from the group leaders to the root
+   * process, such that the returned vector contains the data of all
+   * processes of the communicator (ordered by ranks) on the root process.
+   * On the other processes, an empty vector is returned. If @p store_layout
+   * is set, the number of entries per process and per group are stored in
+   * the member variables for use in operator().
+   */
+  template <typename T>
+  std::vector<T>
+  gather_on_root(const std::vector<T> &local_data,
+                 const bool            store_layout = false);
+
+  /**
+   * Communicator of the processes of the group of the present process, in
+   * which the group leader has rank zero.
+   */
+  MPI_Comm group_communicator = MPI_COMM_SELF;
+
+  /**
+   * Communicator of the group leaders, or MPI_COMM_NULL on all other
+   * processes.
+   */
+  MPI_Comm leader_communicator = MPI_COMM_NULL;
+
+  /**
+   * The number of groups.
+   */
+  unsigned int n_groups = 0;
+
+  /**
+   * Whether the present process is the root process, which holds the
+   * factorization.
+   */
+  bool is_root = false;
+
+  /**
+   * The global indices of the locally owned rows.
+   */
+  std::vector<types::global_dof_index> locally_owned_indices;
+
+  /**
+   * On the group leaders, the number of locally owned rows of each process
+   * of the group and the offsets of these rows in the data gathered on the
+   * group leader.
+   */
+  std::vector<int> group_counts, group_offsets;
+
+  /**
+   * On the group leaders, the number of rows of the group.
+   */
+  unsigned int n_group_rows = 0;
+
+  /**
+   * On the root process, the number of rows of each group and the offsets
+   * of these rows in the data gathered from the group leaders.
+   */
+  std::vector<int> leader_counts, leader_offsets;
+
+  /**
+   * On the root process, the global index of each entry of the data
+   * gathered from the group leaders.
+   */
+  std::vector<types::global_dof_index> gathered_indices;
+
+  /**
+   * The factorization of the matrix, present on the root process.
+   */
+  std::unique_ptr<SparseDirectUMFPACK> solver;
+
+  /**
+   * Communication buffers.
+   */
+  mutable std::vector<double> local_values, group_values, all_values;
+
+  /**
+   * The right hand side and solution vector on the root process.
+   */
+  mutable Vector<double> solution;
+};
+
 /** @} */
 
 #ifndef DOXYGEN
@@ -561,6 +776,353 @@ MGCoarseGridSVD<number, VectorType>::log() const
 }
 
 
+
+/* ------------------ Functions for MGCoarseGridSparseDirect ------------ */
+
+template <typename VectorType>
+MGCoarseGridSparseDirect<VectorType>::AdditionalData::AdditionalData(
+  const unsigned int max_group_size)
+  : max_group_size(max_group_size)
+{}
+
+
+
+template <typename VectorType>
+MGCoarseGridSparseDirect<VectorType>::~MGCoarseGridSparseDirect()
+{
+  clear();
+}
+
+
+
+template <typename VectorType>
+template <typename MatrixType>
+void
+MGCoarseGridSparseDirect<VectorType>::initialize(
+  const MatrixType     &matrix,
+  const IndexSet       &locally_owned_rows,
+  const MPI_Comm        communicator,
+  const AdditionalData &additional_data)
+{
+  clear();
+
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(communicator);
+
+  const unsigned int group_size = std::max(1U, additional_data.max_group_size);
+
+  n_groups = (n_procs + group_size - 1) / group_size;
+  is_root  = (my_rank == 0);
+
+#ifdef DEAL_II_WITH_MPI
+  if (Utilities::MPI::job_supports_mpi())
+    {
+      int ierr = MPI_Comm_split(communicator,
+                                my_rank / group_size,
+                                my_rank,
+                                &group_communicator);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_Comm_split(communicator,
+                            (my_rank % group_size == 0) ? 0 : MPI_UNDEFINED,
+                            my_rank,
+                            &leader_communicator);
+      AssertThrowMPI(ierr);
+    }
+#endif
+
+  locally_owned_indices = locally_owned_rows.get_index_vector();
+  gathered_indices      = gather_on_root(locally_owned_indices, true);
+
+  // collect the entries of the locally owned rows
+  std::vector<unsigned int>            row_lengths;
+  std::vector<types::global_dof_index> columns;
+  std::vector<double>                  values;
+  row_lengths.reserve(locally_owned_indices.size());
+  for (const types::global_dof_index row : locally_owned_indices)
+    {
+      unsigned int row_length = 0;
+      for (auto entry = matrix.begin(row); entry != matrix.end(row); ++entry)
+        {
+          columns.push_back(entry->column());
+          values.push_back(entry->value());
+          ++row_length;
+        }
+      row_lengths.push_back(row_length);
+    }
+
+  const std::vector<unsigned int> gathered_row_lengths =
+    gather_on_root(row_lengths);
+  const std::vector<types::global_dof_index> gathered_columns =
+    gather_on_root(columns);
+  const std::vector<double> gathered_values = gather_on_root(values);
+
+  if (is_root)
+    {
+      const types::global_dof_index n = locally_owned_rows.size();
+      AssertDimension(gathered_indices.size(), n);
+
+      DynamicSparsityPattern dsp(n, n);
+      for (std::size_t i = 0, k = 0; i < gathered_indices.size(); ++i)
+        for (unsigned int j = 0; j < gathered_row_lengths[i]; ++j, ++k)
+          dsp.add(gathered_indices[i], gathered_columns[k]);
+
+      SparsityPattern sparsity_pattern;
+      sparsity_pattern.copy_from(dsp);
+      SparseMatrix<double> coarse_matrix(sparsity_pattern);
+      for (std::size_t i = 0, k = 0; i < gathered_indices.size(); ++i)
+        for (unsigned int j = 0; j < gathered_row_lengths[i]; ++j, ++k)
+          coarse_matrix.add(gathered_indices[i],
+                            gathered_columns[k],
+                            gathered_values[k]);
+
+      solver = std::make_unique<SparseDirectUMFPACK>();
+      solver->initialize(coarse_matrix);
+      solution.reinit(n);
+    }
+}
+
+
+
+template <typename VectorType>
+void
+MGCoarseGridSparseDirect<VectorType>::clear()
+{
+  if (group_communicator != MPI_COMM_SELF)
+    Utilities::MPI::free_communicator(group_communicator);
+  if (leader_communicator != MPI_COMM_NULL)
+    Utilities::MPI::free_communicator(leader_communicator);
+  group_communicator  = MPI_COMM_SELF;
+  leader_communicator = MPI_COMM_NULL;
+
+  n_groups     = 0;
+  is_root      = false;
+  n_group_rows = 0;
+  locally_owned_indices.clear();
+  group_counts.clear();
+  group_offsets.clear();
+  leader_counts.clear();
+  leader_offsets.clear();
+  gathered_indices.clear();
+  solver.reset();
+  solution.reinit(0);
+}
+
+
+
+template <typename VectorType>
+void
+MGCoarseGridSparseDirect<VectorType>::operator()(
+  const unsigned int /*level*/,
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(n_groups > 0, ExcNotInitialized());
+
+  local_values.resize(locally_owned_indices.size());
+  for (unsigned int i = 0; i < locally_owned_indices.size(); ++i)
+    local_values[i] = src(locally_owned_indices[i]);
+
+  group_values.resize(n_group_rows);
+  all_values.resize(gathered_indices.size());
+
+  // collect the right hand side within the groups and then on the root
+  // process
+#ifdef DEAL_II_WITH_MPI
+  if (group_communicator != MPI_COMM_SELF)
+    {
+      int ierr = MPI_Gatherv(local_values.data(),
+                             local_values.size(),
+                             MPI_DOUBLE,
+                             group_values.data(),
+                             group_counts.data(),
+                             group_offsets.data(),
+                             MPI_DOUBLE,
+                             0,
+                             group_communicator);
+      AssertThrowMPI(ierr);
+
+      if (is_group_leader())
+        {
+          ierr = MPI_Gatherv(group_values.data(),
+                             group_values.size(),
+                             MPI_DOUBLE,
+                             all_values.data(),
+                             leader_counts.data(),
+                             leader_offsets.data(),
+                             MPI_DOUBLE,
+                             0,
+                             leader_communicator);
+          AssertThrowMPI(ierr);
+        }
+    }
+  else
+#endif
+    all_values = local_values;
+
+  if (is_root)
+    {
+      for (unsigned int i = 0; i < gathered_indices.size(); ++i)
+        solution(gathered_indices[i]) = all_values[i];
+
+      solver->solve(solution);
+
+      for (unsigned int i = 0; i < gathered_indices.size(); ++i)
+        all_values[i] = solution(gathered_indices[i]);
+    }
+
+  // distribute the solution to the group leaders and then within the groups
+#ifdef DEAL_II_WITH_MPI
+  if (group_communicator != MPI_COMM_SELF)
+    {
+      if (is_group_leader())
+        {
+          const int ierr = MPI_Scatterv(all_values.data(),
+                                        leader_counts.data(),
+                                        leader_offsets.data(),
+                                        MPI_DOUBLE,
+                                        group_values.data(),
+                                        group_values.size(),
+                                        MPI_DOUBLE,
+                                        0,
+                                        leader_communicator);
+          AssertThrowMPI(ierr);
+        }
+
+      const int ierr = MPI_Scatterv(group_values.data(),
+                                    group_counts.data(),
+                                    group_offsets.data(),
+                                    MPI_DOUBLE,
+                                    local_values.data(),
+                                    local_values.size(),
+                                    MPI_DOUBLE,
+                                    0,
+                                    group_communicator);
+      AssertThrowMPI(ierr);
+    }
+  else
+#endif
+    local_values = all_values;
+
+  for (unsigned int i = 0; i < locally_owned_indices.size(); ++i)
+    dst(locally_owned_indices[i]) =
+      static_cast<typename VectorType::value_type>(local_values[i]);
+}
+
+
+
+template <typename VectorType>
+unsigned int
+MGCoarseGridSparseDirect<VectorType>::n_factorizing_processes() const
+{
+  return n_groups > 0 ? 1 : 0;
+}
+
+
+
+template <typename VectorType>
+bool
+MGCoarseGridSparseDirect<VectorType>::is_group_leader() const
+{
+  return group_communicator == MPI_COMM_SELF ||
+         leader_communicator != MPI_COMM_NULL;
+}
+
+
+
+template <typename VectorType>
+template <typename T>
+std::vector<T>
+MGCoarseGridSparseDirect<VectorType>::gather_on_root(
+  const std::vector<T> &local_data,
+  const bool            store_layout)
+{
+  std::vector<int> counts(1, local_data.size());
+  std::vector<T>   result;
+
+#ifdef DEAL_II_WITH_MPI
+  if (group_communicator != MPI_COMM_SELF)
+    {
+      const int n_local = local_data.size();
+      counts.resize(is_group_leader() ?
+                      Utilities::MPI::n_mpi_processes(group_communicator) :
+                      0);
+      int ierr = MPI_Gather(
+        &n_local, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, group_communicator);
+      AssertThrowMPI(ierr);
+
+      std::vector<int> offsets(counts.size());
+      for (unsigned int i = 1; i < counts.size(); ++i)
+        offsets[i] = offsets[i - 1] + counts[i - 1];
+      std::vector<T> group_data(
+        counts.empty() ? 0 : (offsets.back() + counts.back()));
+      ierr = MPI_Gatherv(local_data.data(),
+                         n_local,
+                         Utilities::MPI::mpi_type_id_for_type<T>,
+                         group_data.data(),
+                         counts.data(),
+                         offsets.data(),
+                         Utilities::MPI::mpi_type_id_for_type<T>,
+                         0,
+                         group_communicator);
+      AssertThrowMPI(ierr);
+
+      if (!is_group_leader())
+        return result;
+
+      const int        n_group = group_data.size();
+      std::vector<int> counts_leaders(is_root ? n_groups : 0);
+      ierr = MPI_Gather(&n_group,
+                        1,
+                        MPI_INT,
+                        counts_leaders.data(),
+                        1,
+                        MPI_INT,
+                        0,
+                        leader_communicator);
+      AssertThrowMPI(ierr);
+
+      std::vector<int> offsets_leaders(counts_leaders.size());
+      for (unsigned int i = 1; i < counts_leaders.size(); ++i)
+        offsets_leaders[i] = offsets_leaders[i - 1] + counts_leaders[i - 1];
+      if (is_root)
+        result.resize(offsets_leaders.back() + counts_leaders.back());
+      ierr = MPI_Gatherv(group_data.data(),
+                         n_group,
+                         Utilities::MPI::mpi_type_id_for_type<T>,
+                         result.data(),
+                         counts_leaders.data(),
+                         offsets_leaders.data(),
+                         Utilities::MPI::mpi_type_id_for_type<T>,
+                         0,
+                         leader_communicator);
+      AssertThrowMPI(ierr);
+
+      if (store_layout)
+        {
+          group_counts   = counts;
+          group_offsets  = offsets;
+          n_group_rows   = n_group;
+          leader_counts  = counts_leaders;
+          leader_offsets = offsets_leaders;
+        }
+      return result;
+    }
+#endif
+
+  result = local_data;
+  if (store_layout)
+    {
+      group_counts   = counts;
+      group_offsets  = {0};
+      n_group_rows   = local_data.size();
+      leader_counts  = counts;
+      leader_offsets = {0};
+    }
+  return result;
+}
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
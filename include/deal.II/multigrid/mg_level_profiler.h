@@ -0,0 +1,310 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#ifndef dealii_mg_level_profiler_h
+#define dealii_mg_level_profiler_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_stub.h>
+
+#include <deal.II/multigrid/multigrid.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A class that measures the wall time spent in the individual phases of a
+ * multigrid cycle, separately for each level. The object is attached to a
+ * Multigrid or a PreconditionMG object via connect(), which connects to the
+ * signals described in mg::Signals, and accumulates the wall time and the
+ * number of calls of each phase on each level over all subsequent cycles.
+ *
+ * The function print_summary() prints a table of the minimum, average, and
+ * maximum accumulated wall time over all MPI processes for each level and
+ * phase, similar to the output of TimerOutput. A typical use looks as
+ * follows:
+ * @code
+ * MGLevelProfiler profiler(MPI_COMM_WORLD);
+ * profiler.connect(preconditioner);
+ *
+ * solver.solve(system_matrix, solution, rhs, preconditioner);
+ *
+ * profiler.print_summary(std::cout);
+ * @endcode
+ *
+ * The phases are timed locally without synchronizing the MPI processes, in
+ * order not to alter the run time behavior of the cycle. Waiting times due
+ * to load imbalance on a level hence show up in the phases that communicate,
+ * and a large spread between the minimum and maximum times points to the
+ * level on which the processes wait for each other.
+ */
+class MGLevelProfiler
+{
+public:
+  /**
+   * The phases of a multigrid cycle measured by this class. The names match
+   * the corresponding members of mg::Signals.
+   */
+  enum class Phase
+  {
+    /**
+     * Pre-smoothing on a level.
+     */
+    pre_smoother_step,
+    /**
+     * Computation of the residual on a level, including edge matrices.
+     */
+    residual_step,
+    /**
+     * Restriction from a level to the next coarser one.
+     */
+    restriction,
+    /**
+     * Coarse-grid solve on the coarsest level.
+     */
+    coarse_solve,
+    /**
+     * Prolongation from the next coarser level to a level.
+     */
+    prolongation,
+    /**
+     * Application of the edge matrices after the prolongation.
+     */
+    edge_prolongation,
+    /**
+     * Post-smoothing on a level.
+     */
+    post_smoother_step,
+    /**
+     * Transfer of the global vector to the multilevel vector in
+     * PreconditionMG. This phase is not associated with a level.
+     */
+    transfer_to_mg,
+    /**
+     * Transfer of the multilevel vector to the global vector in
+     * PreconditionMG. This phase is not associated with a level.
+     */
+    transfer_to_global
+  };
+
+  /**
+   * Constructor. The communicator @p mpi_communicator is used for
+   * collecting the statistics over all processes in print_summary().
+   */
+  explicit MGLevelProfiler(const MPI_Comm mpi_communicator);
+
+  /**
+   * The connections to the signals store a pointer to this object, so
+   * copying is not allowed.
+   */
+  MGLevelProfiler(const MGLevelProfiler &) = delete;
+
+  /**
+   * The connections to the signals store a pointer to this object, so
+   * copying is not allowed.
+   */
+  MGLevelProfiler &
+  operator=(const MGLevelProfiler &) = delete;
+
+  /**
+   * Destructor. Disconnects from all signals.
+   */
+  ~MGLevelProfiler();
+
+  /**
+   * Connect to the signals of the level phases of @p mg.
+   */
+  template <typename VectorType>
+  void
+  connect(Multigrid<VectorType> &mg);
+
+  /**
+   * Connect to the signals of the level phases of the Multigrid object used
+   * by @p preconditioner as well as to the signals of the transfer between
+   * the global and the multilevel vectors.
+   */
+  template <int dim, typename VectorType, typename TransferType>
+  void
+  connect(PreconditionMG<dim, VectorType, TransferType> &preconditioner);
+
+  /**
+   * Disconnect from all signals. The data collected so far is kept.
+   */
+  void
+  disconnect();
+
+  /**
+   * Reset the collected data.
+   */
+  void
+  reset();
+
+  /**
+   * Return the wall time in seconds accumulated by the present process in
+   * phase @p phase on level @p level. The level is ignored for the phases
+   * Phase::transfer_to_mg and Phase::transfer_to_global.
+   */
+  double
+  get_wall_time(const Phase        phase,
+                const unsigned int level = numbers::invalid_unsigned_int) const;
+
+  /**
+   * Return the number of calls of phase @p phase on level @p level seen by
+   * the present process. The level is ignored for the phases
+   * Phase::transfer_to_mg and Phase::transfer_to_global.
+   */
+  unsigned long long int
+  get_n_calls(const Phase        phase,
+              const unsigned int level = numbers::invalid_unsigned_int) const;
+
+  /**
+   * Print a table with the number of calls and the minimum, average, and
+   * maximum accumulated wall time over all processes of each phase on each
+   * level, starting from the finest level. Phases that have not been called
+   * on any process are omitted.
+   *
+   * This is a collective operation on the communicator given to the
+   * constructor. The table is only written on the process with rank zero.
+   */
+  void
+  print_summary(std::ostream &out) const;
+
+private:
+  /**
+   * Data collected for one phase.
+   */
+  struct PhaseData
+  {
+    /**
+     * Accumulated wall time in seconds.
+     */
+    double wall_time = 0.;
+
+    /**
+     * Number of completed calls.
+     */
+    unsigned long long int n_calls = 0;
+
+    /**
+     * Time at which the currently running call has started.
+     */
+    std::chrono::steady_clock::time_point start_time;
+  };
+
+  /**
+   * Number of phases associated with a level.
+   */
+  static constexpr unsigned int n_level_phases = 7;
+
+  /**
+   * Start (@p before is true) or stop (@p before is false) measuring phase
+   * @p phase on level @p level. This is the function connected to the
+   * signals.
+   */
+  void
+  record(const bool before, const Phase phase, const unsigned int level);
+
+  /**
+   * Return the data of phase @p phase on level @p level, or a null pointer
+   * if no data has been recorded for it.
+   */
+  const PhaseData *
+  get_data(const Phase phase, const unsigned int level) const;
+
+  /**
+   * MPI communicator for the statistics.
+   */
+  const MPI_Comm mpi_communicator;
+
+  /**
+   * The data of the level phases, indexed by level and phase.
+   */
+  std::vector<std::array<PhaseData, n_level_phases>> level_data;
+
+  /**
+   * The data of the phases Phase::transfer_to_mg and
+   * Phase::transfer_to_global.
+   */
+  std::array<PhaseData, 2> transfer_data;
+
+  /**
+   * Connections to the signals, released upon disconnect().
+   */
+  std::vector<boost::signals2::connection> connections;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/* ------------------------ inline functions ------------------------------ */
+
+
+template <typename VectorType>
+inline void
+MGLevelProfiler::connect(Multigrid<VectorType> &mg)
+{
+  const auto slot = [this](const Phase phase) {
+    return [this, phase](const bool before, const unsigned int level) {
+      this->record(before, phase, level);
+    };
+  };
+
+  connections.push_back(
+    mg.connect_pre_smoother_step(slot(Phase::pre_smoother_step)));
+  connections.push_back(mg.connect_residual_step(slot(Phase::residual_step)));
+  connections.push_back(mg.connect_restriction(slot(Phase::restriction)));
+  connections.push_back(mg.connect_coarse_solve(slot(Phase::coarse_solve)));
+  connections.push_back(mg.connect_prolongation(slot(Phase::prolongation)));
+  connections.push_back(
+    mg.connect_edge_prolongation(slot(Phase::edge_prolongation)));
+  connections.push_back(
+    mg.connect_post_smoother_step(slot(Phase::post_smoother_step)));
+}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+inline void
+MGLevelProfiler::connect(
+  PreconditionMG<dim, VectorType, TransferType> &preconditioner)
+{
+  connect(preconditioner.get_multigrid());
+
+  connections.push_back(
+    preconditioner.connect_transfer_to_mg([this](const bool before) {
+      this->record(before, Phase::transfer_to_mg, 0);
+    }));
+  connections.push_back(
+    preconditioner.connect_transfer_to_global([this](const bool before) {
+      this->record(before, Phase::transfer_to_global, 0);
+    }));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
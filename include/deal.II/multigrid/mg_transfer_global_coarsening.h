@@ -132,6 +132,37 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * Create a communicator that only contains the processes of the
+   * communicator of @p tria that own active cells, ordered by their rank in
+   * the original communicator. On processes without locally owned active
+   * cells, a duplicate of MPI_COMM_SELF is returned. This function is
+   * collective over the communicator of @p tria.
+   *
+   * The triangulations on the coarse levels returned by
+   * create_geometric_coarsening_sequence() with a policy like
+   * RepartitioningPolicyTools::MinimalGranularityPolicy often only have cells
+   * on a small subset of processes. Passing the communicator returned by
+   * this function to MatrixFree::AdditionalData::communicator of the level
+   * operators restricts the vector partitioners, and with them the ghost
+   * exchange and the reductions on the level, to these processes. The
+   * MGTwoLevelTransfer objects between levels with different communicators
+   * detect the switch and perform the communication of the transfer with
+   * the communicator of the triangulations, copying the locally owned
+   * entries from and to the level vectors.
+   *
+   * Processes without cells still participate in the multigrid cycle, but
+   * they only operate on empty vectors, such that reductions like norms
+   * and inner products evaluate to zero there and iterative methods on the
+   * level, e.g., a coarse-grid solver, return immediately.
+   *
+   * @note The returned communicator needs to be freed with
+   *   Utilities::MPI::free_communicator() once it is no longer used.
+   */
+  template <int dim, int spacedim>
+  MPI_Comm
+  create_level_communicator(const Triangulation<dim, spacedim> &tria);
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -23,6 +23,7 @@
 
 #include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 
+#include <algorithm>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -272,6 +273,41 @@ namespace MGTransferGlobalCoarseningTools
       repartition_fine_triangulation);
   }
 
+
+
+  template <int dim, int spacedim>
+  MPI_Comm
+  create_level_communicator(const Triangulation<dim, spacedim> &tria)
+  {
+    const MPI_Comm comm = tria.get_mpi_communicator();
+
+#ifndef DEAL_II_WITH_MPI
+    return comm;
+#else
+    const bool has_locally_owned_cells =
+      std::any_of(tria.begin_active(),
+                  typename Triangulation<dim, spacedim>::active_cell_iterator(
+                    tria.end()),
+                  [](const auto &cell) { return cell.is_locally_owned(); });
+
+    MPI_Comm level_comm = MPI_COMM_NULL;
+
+    int ierr = MPI_Comm_split(comm,
+                              has_locally_owned_cells ? 0 : MPI_UNDEFINED,
+                              Utilities::MPI::this_mpi_process(comm),
+                              &level_comm);
+    AssertThrowMPI(ierr);
+
+    if (level_comm == MPI_COMM_NULL)
+      {
+        ierr = MPI_Comm_dup(MPI_COMM_SELF, &level_comm);
+        AssertThrowMPI(ierr);
+      }
+
+    return level_comm;
+#endif
+  }
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -354,6 +354,13 @@ namespace internal
  * to be made, reducing both the setup time and the overall memory
  * consumption. Note that not all options are supported for the second entry
  * point, and we fall back to the first option in such a case.
+ *
+ * For polynomial coarsening, the first option also supports finite elements
+ * composed of several scalar base elements, like the Taylor-Hood element
+ * FESystem(FE_Q(k)^dim, FE_Q(k-1)). In that case, each base element is
+ * transferred separately to the corresponding base element on the coarse
+ * side, which must have the same multiplicity, using sum factorization for
+ * tensor-product elements.
  */
 template <int dim, typename VectorType>
 class MGTwoLevelTransfer
@@ -566,6 +573,66 @@ private:
      * fast application of hanging-node constraints.
      */
     internal::MatrixFreeFunctions::ShapeInfo<double> shape_info_coarse;
+
+    /**
+     * Transfer of the components belonging to one base element of a
+     * finite element composed of several base elements.
+     */
+    struct BaseElementScheme
+    {
+      /**
+       * Number of components of the base element, i.e., its multiplicity.
+       */
+      unsigned int n_components;
+
+      /**
+       * Number of degrees of freedom of a single component on the coarse
+       * cell.
+       */
+      unsigned int n_dofs_per_component_coarse;
+
+      /**
+       * Number of degrees of freedom of a single component on the fine
+       * cell.
+       */
+      unsigned int n_dofs_per_component_fine;
+
+      /**
+       * Polynomial degree of the base element on the coarse cell.
+       */
+      unsigned int degree_coarse;
+
+      /**
+       * Polynomial degree of the base element on the fine cell.
+       */
+      unsigned int degree_fine;
+
+      /**
+       * Prolongation matrix of the base element, either in 1d for
+       * tensor-product elements or for the full cell otherwise. Empty if
+       * the base elements on the coarse and the fine cell coincide.
+       */
+      AlignedVector<double> prolongation_matrix;
+
+      /**
+       * Restriction matrix of the base element used for the interpolate()
+       * function.
+       */
+      AlignedVector<double> restriction_matrix;
+    };
+
+    /**
+     * Transfer of the individual base elements for a polynomial transfer
+     * between finite elements composed of several base elements, like
+     * FESystem(FE_Q(k)^dim, FE_Q(k-1)). The degrees of freedom of a cell are
+     * then arranged component by component in the order of the base
+     * elements, and the base elements are transferred one after the other,
+     * with sum factorization for tensor-product elements and with a full
+     * matrix otherwise. Empty for finite elements with a single base element,
+     * in which case the member variables above describe the transfer of all
+     * components.
+     */
+    std::vector<BaseElementScheme> base_element_schemes;
   };
 
   /**
@@ -236,6 +236,107 @@ namespace internal
     {}
   };
 
+  /**
+   * Apply the cell-wise prolongation for a finite element composed of
+   * several base elements. The degrees of freedom of the cell are arranged
+   * component by component in the order of the base elements, and each
+   * component is prolongated with the matrix of its base element.
+   */
+  template <int dim, typename BaseElementScheme, typename Number2>
+  void
+  prolongate_base_elements(
+    const std::vector<BaseElementScheme> &base_element_schemes,
+    const Number2                        *evaluation_data_coarse,
+    Number2                              *evaluation_data_fine)
+  {
+    for (const auto &base : base_element_schemes)
+      {
+        CellTransferFactory cell_transfer(base.degree_fine, base.degree_coarse);
+
+        for (unsigned int c = 0; c < base.n_components; ++c)
+          {
+            if (base.prolongation_matrix.empty() == false)
+              {
+                CellProlongator<dim, double, Number2> cell_prolongator(
+                  base.prolongation_matrix,
+                  evaluation_data_coarse,
+                  evaluation_data_fine);
+
+                if (base.prolongation_matrix.size() <
+                    base.n_dofs_per_component_fine *
+                      base.n_dofs_per_component_coarse)
+                  cell_transfer.run(cell_prolongator);
+                else
+                  cell_prolongator.run_full(base.n_dofs_per_component_fine,
+                                            base.n_dofs_per_component_coarse);
+              }
+            else
+              {
+                AssertDimension(base.n_dofs_per_component_fine,
+                                base.n_dofs_per_component_coarse);
+                std::copy(evaluation_data_coarse,
+                          evaluation_data_coarse +
+                            base.n_dofs_per_component_coarse,
+                          evaluation_data_fine);
+              }
+
+            evaluation_data_coarse += base.n_dofs_per_component_coarse;
+            evaluation_data_fine += base.n_dofs_per_component_fine;
+          }
+      }
+  }
+
+  /**
+   * Same as above but for the cell-wise restriction. If
+   * @p use_restriction_matrix is set, the restriction matrices of the base
+   * elements are applied, as needed for interpolation, otherwise the
+   * transpose of the prolongation matrices.
+   */
+  template <int dim, typename BaseElementScheme, typename Number2>
+  void
+  restrict_base_elements(
+    const std::vector<BaseElementScheme> &base_element_schemes,
+    const bool                            use_restriction_matrix,
+    Number2                              *evaluation_data_fine,
+    Number2                              *evaluation_data_coarse)
+  {
+    for (const auto &base : base_element_schemes)
+      {
+        const AlignedVector<double> &matrix = use_restriction_matrix ?
+                                                base.restriction_matrix :
+                                                base.prolongation_matrix;
+
+        CellTransferFactory cell_transfer(base.degree_fine, base.degree_coarse);
+
+        for (unsigned int c = 0; c < base.n_components; ++c)
+          {
+            if (matrix.empty() == false)
+              {
+                CellRestrictor<dim, double, Number2> cell_restrictor(
+                  matrix, evaluation_data_fine, evaluation_data_coarse);
+
+                if (matrix.size() < base.n_dofs_per_component_fine *
+                                      base.n_dofs_per_component_coarse)
+                  cell_transfer.run(cell_restrictor);
+                else
+                  cell_restrictor.run_full(base.n_dofs_per_component_fine,
+                                           base.n_dofs_per_component_coarse);
+              }
+            else
+              {
+                AssertDimension(base.n_dofs_per_component_fine,
+                                base.n_dofs_per_component_coarse);
+                std::copy(evaluation_data_fine,
+                          evaluation_data_fine + base.n_dofs_per_component_fine,
+                          evaluation_data_coarse);
+              }
+
+            evaluation_data_fine += base.n_dofs_per_component_fine;
+            evaluation_data_coarse += base.n_dofs_per_component_coarse;
+          }
+      }
+  }
+
 } // namespace internal
 
 
@@ -424,6 +525,18 @@ namespace internal
           });
       }
 
+    // the hanging-node constraints are applied with the shape functions of
+    // a single base element
+    if (use_fast_hanging_node_algorithm)
+      {
+        const auto &fes = dof_handler_coarse.get_fe_collection();
+
+        use_fast_hanging_node_algorithm &=
+          std::all_of(fes.begin(), fes.end(), [](const auto &fe) {
+            return fe.n_base_elements() == 1;
+          });
+      }
+
     // check that all components are either supported or not
     if (use_fast_hanging_node_algorithm)
       {
@@ -2192,6 +2305,51 @@ namespace internal
         dim,
         LinearAlgebra::distributed::Vector<Number>>::MGTransferScheme &scheme)
     {
+      // for elements composed of several base elements, set up the transfer
+      // of each base element separately
+      if (fe_fine.n_base_elements() > 1)
+        {
+          AssertDimension(fe_fine.n_base_elements(),
+                          fe_coarse.n_base_elements());
+
+          scheme.base_element_schemes.resize(fe_fine.n_base_elements());
+
+          for (unsigned int b = 0; b < fe_fine.n_base_elements(); ++b)
+            {
+              const FiniteElement<dim> &fe_fine_base = fe_fine.base_element(b);
+              const FiniteElement<dim> &fe_coarse_base =
+                fe_coarse.base_element(b);
+
+              AssertDimension(fe_fine.element_multiplicity(b),
+                              fe_coarse.element_multiplicity(b));
+              AssertDimension(fe_fine_base.n_components(), 1);
+              AssertDimension(fe_coarse_base.n_components(), 1);
+
+              typename MGTwoLevelTransfer<
+                dim,
+                LinearAlgebra::distributed::Vector<Number>>::MGTransferScheme
+                scheme_base;
+              compute_prolongation_and_restriction_matrices<dim, Number>(
+                fe_fine_base, fe_coarse_base, scheme_base);
+
+              auto &base_element_scheme = scheme.base_element_schemes[b];
+              base_element_scheme.n_components =
+                fe_fine.element_multiplicity(b);
+              base_element_scheme.n_dofs_per_component_coarse =
+                fe_coarse_base.n_dofs_per_cell();
+              base_element_scheme.n_dofs_per_component_fine =
+                fe_fine_base.n_dofs_per_cell();
+              base_element_scheme.degree_coarse = fe_coarse_base.degree;
+              base_element_scheme.degree_fine   = fe_fine_base.degree;
+              base_element_scheme.prolongation_matrix =
+                std::move(scheme_base.prolongation_matrix);
+              base_element_scheme.restriction_matrix =
+                std::move(scheme_base.restriction_matrix);
+            }
+
+          return;
+        }
+
       AssertDimension(fe_fine.n_base_elements(), 1);
       AssertDimension(fe_coarse.n_base_elements(), 1);
 
@@ -2385,11 +2543,6 @@ namespace internal
                                 &fe.base_element(0)) != nullptr);
                     });
 
-      const bool has_tp_structure =
-        std::all_of(dof_handler_fine.get_fe_collection().begin(),
-                    dof_handler_fine.get_fe_collection().end(),
-                    [](const auto &fe) { return fe_has_tp_structure(fe); });
-
       const auto process_cells = [&](const auto &fu) {
         loop_over_active_or_level_cells(
           dof_handler_coarse, mg_level_coarse, [&](const auto &cell_coarse) {
@@ -2490,47 +2643,16 @@ namespace internal
                    ExcNotImplemented());
 
             // ------------------- lexicographic_numbering  --------------------
-            if (has_tp_structure)
-              {
-                const Quadrature<1> dummy_quadrature(
-                  std::vector<Point<1>>(1, Point<1>()));
-                internal::MatrixFreeFunctions::ShapeInfo<
-                  VectorizedArray<Number>>
-                  shape_info;
-                shape_info.reinit(dummy_quadrature,
-                                  dof_handler_fine.get_fe(
-                                    fe_index_pair.first.second),
-                                  0);
-                lexicographic_numbering_fine[fe_index_pair.second] =
-                  shape_info.lexicographic_numbering;
-
-                shape_info.reinit(dummy_quadrature,
-                                  dof_handler_coarse.get_fe(
-                                    fe_index_pair.first.first),
-                                  0);
-                lexicographic_numbering_coarse[fe_index_pair.second] =
-                  shape_info.lexicographic_numbering;
-              }
-            else
-              {
-                const auto dummy_quadrature =
-                  reference_cell.get_gauss_type_quadrature(1);
-
-                internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
-                shape_info.reinit(dummy_quadrature,
-                                  dof_handler_fine.get_fe(
-                                    fe_index_pair.first.second),
-                                  0);
-                lexicographic_numbering_fine[fe_index_pair.second] =
-                  shape_info.lexicographic_numbering;
-
-                shape_info.reinit(dummy_quadrature,
-                                  dof_handler_coarse.get_fe(
-                                    fe_index_pair.first.first),
-                                  0);
-                lexicographic_numbering_coarse[fe_index_pair.second] =
-                  shape_info.lexicographic_numbering;
-              }
+            lexicographic_numbering_fine[fe_index_pair.second] =
+              internal::MatrixFreeFunctions::
+                compute_lexicographic_numbering_of_all_base_elements<dim,
+                                                                     Number>(
+                  dof_handler_fine.get_fe(fe_index_pair.first.second));
+            lexicographic_numbering_coarse[fe_index_pair.second] =
+              internal::MatrixFreeFunctions::
+                compute_lexicographic_numbering_of_all_base_elements<dim,
+                                                                     Number>(
+                  dof_handler_coarse.get_fe(fe_index_pair.first.first));
           }
 
         for (unsigned int i = 0; i < fe_index_pairs.size(); ++i)
@@ -3055,7 +3177,12 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
                 cell_counter, n_lanes_filled, false, evaluation_data_coarse);
 
               // ---------------------------- coarse ---------------------------
-              if (needs_interpolation)
+              if (scheme.base_element_schemes.empty() == false)
+                internal::prolongate_base_elements<dim>(
+                  scheme.base_element_schemes,
+                  evaluation_data_coarse.data(),
+                  evaluation_data_fine.data());
+              else if (needs_interpolation)
                 for (int c = n_components - 1; c >= 0; --c)
                   {
                     internal::CellProlongator<dim, double, VectorizedArrayType>
@@ -3265,7 +3392,13 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
                 }
 
               // ------------------------------ fine ---------------------------
-              if (needs_interpolation)
+              if (scheme.base_element_schemes.empty() == false)
+                internal::restrict_base_elements<dim>(
+                  scheme.base_element_schemes,
+                  false,
+                  evaluation_data_fine.data(),
+                  evaluation_data_coarse.data());
+              else if (needs_interpolation)
                 for (int c = n_components - 1; c >= 0; --c)
                   {
                     internal::CellRestrictor<dim, double, VectorizedArrayType>
@@ -3448,7 +3581,13 @@ MGTwoLevelTransfer<dim, VectorType>::interpolate(VectorType       &dst,
                 false);
 
               // ------------------------------ fine ---------------------------
-              if (needs_interpolation)
+              if (scheme.base_element_schemes.empty() == false)
+                internal::restrict_base_elements<dim>(
+                  scheme.base_element_schemes,
+                  true,
+                  evaluation_data_fine.data(),
+                  evaluation_data_coarse.data());
+              else if (needs_interpolation)
                 for (int c = n_components - 1; c >= 0; --c)
                   {
                     internal::CellRestrictor<dim, double, VectorizedArrayType>
@@ -3518,12 +3657,32 @@ namespace internal
         partitioner->locally_owned_range())
       return false;
 
+    // the ghost exchange would be performed with the communicator of the
+    // external partitioner, which is not possible if the level operators
+    // work on a communicator restricted to the processes with cells (see
+    // MGTransferGlobalCoarseningTools::create_level_communicator())
+    bool same_communicator = true;
+#ifdef DEAL_II_WITH_MPI
+    if (Utilities::MPI::job_supports_mpi())
+      {
+        int       communicators_same = 0;
+        const int ierr =
+          MPI_Comm_compare(external_partitioner->get_mpi_communicator(),
+                           partitioner->get_mpi_communicator(),
+                           &communicators_same);
+        AssertThrowMPI(ierr);
+        same_communicator = (communicators_same == MPI_IDENT ||
+                             communicators_same == MPI_CONGRUENT);
+      }
+#endif
+
     const bool ghosts_locally_contained =
       (external_partitioner->ghost_indices() & partitioner->ghost_indices()) ==
       partitioner->ghost_indices();
 
     // check if ghost values are contained in external partititioner
-    return Utilities::MPI::logical_and(ghosts_locally_contained,
+    return Utilities::MPI::logical_and(same_communicator &&
+                                         ghosts_locally_contained,
                                        partitioner->get_mpi_communicator());
   }
 
@@ -3815,6 +3974,11 @@ MGTwoLevelTransfer<dim, VectorType>::reinit(
 
   const FiniteElement<dim> &fe_fine = dof_fine.get_fe();
 
+  Assert(fe_fine.n_base_elements() == 1,
+         ExcMessage("Finite elements composed of several base elements are "
+                    "currently only supported by the reinit() function "
+                    "taking DoFHandler objects."));
+
   AssertDimension(fe_fine.n_components(), dof_coarse.get_fe().n_components());
   this->n_components = fe_fine.n_components();
 
@@ -3952,6 +4116,12 @@ MGTwoLevelTransfer<dim, VectorType>::memory_consumption() const
     {
       size += scheme.prolongation_matrix.memory_consumption();
       size += scheme.restriction_matrix.memory_consumption();
+
+      for (const auto &base_element_scheme : scheme.base_element_schemes)
+        {
+          size += base_element_scheme.prolongation_matrix.memory_consumption();
+          size += base_element_scheme.restriction_matrix.memory_consumption();
+        }
     }
 
   if (matrix_free_data.get() != nullptr)
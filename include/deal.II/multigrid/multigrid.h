@@ -210,6 +210,17 @@ public:
   void
   cycle();
 
+  /**
+   * Same as above, but start the cycle on @p level instead of the finest
+   * level #maxlevel, using the levels between #minlevel and @p level only.
+   * The defect on @p level is expected in #defect, and the defects on the
+   * coarser levels need to be zero (or contain additional contributions,
+   * like after copy_to_mg). This function is used by FullMultigrid for the
+   * cycles on the intermediate levels.
+   */
+  void
+  cycle(const unsigned int level);
+
   /**
    * Execute one step of the V-cycle algorithm.  This function assumes, that
    * the multilevel vector #defect is filled with the residual of an outer
@@ -482,6 +493,9 @@ private:
 
   template <int dim, typename OtherVectorType, typename TransferType>
   friend class PreconditionMG;
+
+  template <int dim, typename OtherVectorType, typename TransferType>
+  friend class FullMultigrid;
 };
 
 
@@ -649,6 +663,196 @@ private:
   mg::Signals signals;
 };
 
+/**
+ * A driver for solving a linear system with nested iteration on the
+ * multigrid hierarchy, also known as full multigrid (FMG). Contrary to
+ * PreconditionMG, which applies a single cycle to a residual of an outer
+ * iterative solver, this class computes an approximation of the solution
+ * itself: The right hand side is restricted to all levels and the problem is
+ * solved on the coarsest level. Then, the solution is interpolated to the
+ * next finer level, where it serves as the initial guess for a fixed number
+ * of multigrid cycles (Variant::full_multigrid) or smoothing steps
+ * (Variant::cascadic). This is repeated until the finest level is reached.
+ *
+ * For elliptic problems, a single V-cycle per level typically suffices to
+ * obtain an approximation with an algebraic error below the discretization
+ * error, at a cost proportional to the number of unknowns on the finest
+ * level. This makes the class suitable as a replacement for a direct solver
+ * or a full Krylov solve, e.g., in time-stepping codes, where only
+ * discretization accuracy is needed. For a given accuracy, the result can
+ * also be used as initial guess for an iterative solver preconditioned by
+ * PreconditionMG, using the same Multigrid object.
+ *
+ * The class uses the level matrices, smoothers, coarse grid solver, level
+ * transfer operators, and cycle type of the Multigrid object passed to the
+ * constructor. The object of type `TransferType` is used for the transfer
+ * between the global vectors and the level vectors only, like in
+ * PreconditionMG. Optionally, a separate user-provided level transfer object
+ * can be passed that is used for interpolating the solution from one level
+ * to the next finer one instead of the level transfer of the Multigrid
+ * object. The library does not provide a dedicated interpolation operator
+ * for this purpose. The restriction of the right hand side always uses the
+ * transfer of the Multigrid object.
+ *
+ * @note Nested iteration needs a solution on each level that represents the
+ * whole domain. Therefore, this class is intended for the global coarsening
+ * framework, see MGTransferGlobalCoarsening, or for uniformly refined meshes
+ * with local smoothing. The residuals computed by this class before the
+ * cycles on each level do not include edge matrices, so the Multigrid object
+ * must not have edge matrices set, which is checked in debug mode.
+ *
+ * @note The vector returned by solve() is the result of the transfer from
+ * the finest level. Like for PreconditionMG, the values of constrained
+ * degrees of freedom are not set, so the user needs to call
+ * AffineConstraints::distribute() on the result.
+ */
+template <int dim, typename VectorType, typename TransferType>
+class FullMultigrid : public EnableObserverPointer
+{
+public:
+  /**
+   * The operation performed on each level after the interpolation of the
+   * solution from the next coarser level.
+   */
+  enum Variant
+  {
+    /**
+     * Apply AdditionalData::n_cycles multigrid cycles of the type selected
+     * in the Multigrid object, restricted to the levels up to the current
+     * one.
+     */
+    full_multigrid,
+    /**
+     * Apply AdditionalData::n_cycles steps of the post-smoother of the
+     * Multigrid object, without any coarse grid correction. This is the
+     * cascadic multigrid method, which is cheaper per level but typically
+     * needs more smoothing steps on the coarser levels to reach
+     * discretization accuracy.
+     */
+    cascadic
+  };
+
+  /**
+   * Structure collecting the parameters of this class.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const Variant      variant  = full_multigrid,
+                   const unsigned int n_cycles = 1);
+
+    /**
+     * The operation applied on each level.
+     */
+    Variant variant;
+
+    /**
+     * The number of multigrid cycles or smoothing steps on each level above
+     * the coarsest one.
+     */
+    unsigned int n_cycles;
+  };
+
+  /**
+   * Constructor. Arguments are the associated DoFHandler (@p dof_handler),
+   * the multigrid object (@p mg), the object for the transfer between global
+   * and level vectors (@p transfer), and the parameters of the method. The
+   * solution is interpolated between levels with the level transfer of
+   * @p mg.
+   */
+  FullMultigrid(const DoFHandler<dim> &dof_handler,
+                Multigrid<VectorType> &mg,
+                const TransferType    &transfer,
+                const AdditionalData  &additional_data = AdditionalData());
+
+  /**
+   * Same as above, but interpolate the solution from one level to the next
+   * finer one with @p interpolation instead of the level transfer of @p mg.
+   */
+  FullMultigrid(const DoFHandler<dim>            &dof_handler,
+                Multigrid<VectorType>            &mg,
+                const TransferType               &transfer,
+                const MGTransferBase<VectorType> &interpolation,
+                const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Compute an approximation of the solution @p dst of the linear system
+   * with right hand side @p src, represented by the level matrices of the
+   * Multigrid object on its finest level. The content of @p dst on entry is
+   * ignored.
+   */
+  template <typename OtherVectorType>
+  void
+  solve(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Same as solve(). This function allows to use the present object in
+   * place of a preconditioner or an inverse matrix.
+   */
+  template <typename OtherVectorType>
+  void
+  vmult(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Return the Multigrid object passed to the constructor.
+   */
+  Multigrid<VectorType> &
+  get_multigrid();
+
+  /**
+   * Return the Multigrid object passed to the constructor.
+   */
+  const Multigrid<VectorType> &
+  get_multigrid() const;
+
+private:
+  /**
+   * Associated @p DoFHandler.
+   */
+  ObserverPointer<const DoFHandler<dim>,
+                  FullMultigrid<dim, VectorType, TransferType>>
+    dof_handler;
+
+  /**
+   * The multigrid object.
+   */
+  ObserverPointer<Multigrid<VectorType>,
+                  FullMultigrid<dim, VectorType, TransferType>>
+    multigrid;
+
+  /**
+   * Object for the transfer between global and level vectors.
+   */
+  ObserverPointer<const TransferType,
+                  FullMultigrid<dim, VectorType, TransferType>>
+    transfer;
+
+  /**
+   * Object for interpolating the solution to the next finer level. Points
+   * to the level transfer of the Multigrid object unless given separately.
+   */
+  ObserverPointer<const MGTransferBase<VectorType>,
+                  FullMultigrid<dim, VectorType, TransferType>>
+    interpolation;
+
+  /**
+   * The parameters of the method.
+   */
+  const AdditionalData additional_data;
+
+  /**
+   * The right hand side on each level.
+   */
+  mutable MGLevelObject<VectorType> level_rhs;
+
+  /**
+   * The solution on each level.
+   */
+  mutable MGLevelObject<VectorType> level_solution;
+};
+
 /** @} */
 
 #ifndef DOXYGEN
@@ -998,6 +1202,163 @@ PreconditionMG<dim, VectorType, TransferType>::get_multigrid() const
   return *this->multigrid;
 }
 
+/* ----------------------------- FullMultigrid ----------------------------- */
+
+
+template <int dim, typename VectorType, typename TransferType>
+FullMultigrid<dim, VectorType, TransferType>::AdditionalData::AdditionalData(
+  const Variant      variant,
+  const unsigned int n_cycles)
+  : variant(variant)
+  , n_cycles(n_cycles)
+{}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+FullMultigrid<dim, VectorType, TransferType>::FullMultigrid(
+  const DoFHandler<dim> &dof_handler,
+  Multigrid<VectorType> &mg,
+  const TransferType    &transfer,
+  const AdditionalData  &additional_data)
+  : FullMultigrid(dof_handler, mg, transfer, *mg.transfer, additional_data)
+{}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+FullMultigrid<dim, VectorType, TransferType>::FullMultigrid(
+  const DoFHandler<dim>            &dof_handler,
+  Multigrid<VectorType>            &mg,
+  const TransferType               &transfer,
+  const MGTransferBase<VectorType> &interpolation,
+  const AdditionalData             &additional_data)
+  : dof_handler(&dof_handler)
+  , multigrid(&mg)
+  , transfer(&transfer)
+  , interpolation(&interpolation)
+  , additional_data(additional_data)
+{}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+template <typename OtherVectorType>
+void
+FullMultigrid<dim, VectorType, TransferType>::solve(
+  OtherVectorType       &dst,
+  const OtherVectorType &src) const
+{
+  Multigrid<VectorType> &mg       = *multigrid;
+  const unsigned int     minlevel = mg.minlevel;
+  const unsigned int     maxlevel = mg.maxlevel;
+
+  Assert(mg.edge_out == nullptr && mg.edge_in == nullptr &&
+           mg.edge_down == nullptr && mg.edge_up == nullptr,
+         ExcMessage("FullMultigrid does not support edge matrices, since the "
+                    "residuals on the levels are computed without them."));
+
+  // the transfer initializes the level vectors of the defect, which we use
+  // as templates for all other level vectors
+  transfer->copy_to_mg(*dof_handler, mg.defect, src);
+
+  level_rhs.resize(minlevel, maxlevel);
+  level_solution.resize(minlevel, maxlevel);
+
+  // restrict the right hand side to all levels
+  level_rhs[maxlevel].reinit(mg.defect[maxlevel], true);
+  level_rhs[maxlevel] = mg.defect[maxlevel];
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      level_rhs[level - 1].reinit(mg.defect[level - 1]);
+      mg.signals.restriction(true, level);
+      mg.transfer->restrict_and_add(level,
+                                    level_rhs[level - 1],
+                                    level_rhs[level]);
+      mg.signals.restriction(false, level);
+    }
+
+  // solve on the coarsest level
+  level_solution[minlevel].reinit(mg.defect[minlevel]);
+  mg.signals.coarse_solve(true, minlevel);
+  (*mg.coarse)(minlevel, level_solution[minlevel], level_rhs[minlevel]);
+  mg.signals.coarse_solve(false, minlevel);
+
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      // interpolate the solution of the coarser level as initial guess
+      level_solution[level].reinit(mg.defect[level], true);
+      mg.signals.prolongation(true, level);
+      interpolation->prolongate(level,
+                                level_solution[level],
+                                level_solution[level - 1]);
+      mg.signals.prolongation(false, level);
+
+      for (unsigned int i = 0; i < additional_data.n_cycles; ++i)
+        if (additional_data.variant == cascadic)
+          {
+            mg.signals.post_smoother_step(true, level);
+            mg.post_smooth->smooth(level,
+                                   level_solution[level],
+                                   level_rhs[level]);
+            mg.signals.post_smoother_step(false, level);
+          }
+        else
+          {
+            // compute the residual of the current approximation as the
+            // input of a cycle starting on this level. the cycle adds the
+            // restricted residuals to the defects of the coarser levels,
+            // so they need to be zero.
+            mg.signals.residual_step(true, level);
+            mg.matrix->vmult(level, mg.defect[level], level_solution[level]);
+            mg.defect[level].sadd(-1.0, 1.0, level_rhs[level]);
+            mg.signals.residual_step(false, level);
+            for (unsigned int l = minlevel; l < level; ++l)
+              mg.defect[l] = 0.;
+
+            mg.cycle(level);
+            level_solution[level] += mg.solution[level];
+          }
+    }
+
+  // only pass the solution on the finest level to the transfer, which adds
+  // up the contributions of all levels for local smoothing
+  for (unsigned int level = minlevel; level < maxlevel; ++level)
+    level_solution[level] = 0.;
+
+  transfer->copy_from_mg(*dof_handler, dst, level_solution);
+}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+template <typename OtherVectorType>
+void
+FullMultigrid<dim, VectorType, TransferType>::vmult(
+  OtherVectorType       &dst,
+  const OtherVectorType &src) const
+{
+  solve(dst, src);
+}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+Multigrid<VectorType> &
+FullMultigrid<dim, VectorType, TransferType>::get_multigrid()
+{
+  return *this->multigrid;
+}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+const Multigrid<VectorType> &
+FullMultigrid<dim, VectorType, TransferType>::get_multigrid() const
+{
+  return *this->multigrid;
+}
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
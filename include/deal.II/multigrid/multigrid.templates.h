@@ -267,6 +267,18 @@ template <typename VectorType>
 void
 Multigrid<VectorType>::cycle()
 {
+  cycle(maxlevel);
+}
+
+
+
+template <typename VectorType>
+void
+Multigrid<VectorType>::cycle(const unsigned int level)
+{
+  AssertIndexRange(level, maxlevel + 1);
+  Assert(level >= minlevel, ExcLowerRangeType<unsigned int>(level, minlevel));
+
   // The defect vector has been initialized by copy_to_mg. Now adjust the
   // other vectors. First out a check if we have the right number of levels.
   if (solution.min_level() != minlevel || solution.max_level() != maxlevel)
@@ -279,20 +291,20 @@ Multigrid<VectorType>::cycle()
     defect2.resize(minlevel, maxlevel);
 
   // And now we go and reinit the vectors on the levels.
-  for (unsigned int level = minlevel; level <= maxlevel; ++level)
+  for (unsigned int l = minlevel; l <= level; ++l)
     {
-      // the vectors for level>minlevel will be overwritten by the apply()
+      // the vectors for l>minlevel will be overwritten by the apply()
       // method of the smoother -> do not force them to be zeroed out here
-      solution[level].reinit(defect[level], level > minlevel);
-      t[level].reinit(defect[level], level > minlevel);
+      solution[l].reinit(defect[l], l > minlevel);
+      t[l].reinit(defect[l], l > minlevel);
       if (cycle_type != v_cycle)
-        defect2[level].reinit(defect[level]);
+        defect2[l].reinit(defect[l]);
     }
 
   if (cycle_type == v_cycle)
-    level_v_step(maxlevel);
+    level_v_step(level);
   else
-    level_step(maxlevel, cycle_type);
+    level_step(level, cycle_type);
 }
 
 
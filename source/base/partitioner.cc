@@ -19,6 +19,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -59,6 +60,7 @@ namespace Utilities
       locally_owned_range_data.add_range(0, size);
       locally_owned_range_data.compress();
       ghost_indices_data.set_size(size);
+      initialize_interior_and_boundary_ranges();
     }
 
 
@@ -95,6 +97,7 @@ namespace Utilities
 
       locally_owned_range_data.add_range(prefix_sum, prefix_sum + local_size);
       locally_owned_range_data.compress();
+      initialize_interior_and_boundary_ranges();
     }
 
 
@@ -177,6 +180,8 @@ namespace Utilities
       locally_owned_range_data.compress();
 
       ghost_indices_data.set_size(locally_owned_indices.size());
+
+      initialize_interior_and_boundary_ranges();
     }
 
 
@@ -321,6 +326,7 @@ namespace Utilities
                                              interval->last() + 1 -
                                                local_range_data.first);
         }
+      initialize_interior_and_boundary_ranges();
 
       if constexpr (running_in_debug_mode())
         {
@@ -500,6 +506,8 @@ namespace Utilities
                   import_indices_plain_dev.capacity();
       memory += MemoryConsumption::memory_consumption(n_import_indices_data);
       memory += MemoryConsumption::memory_consumption(import_targets_data);
+      memory += MemoryConsumption::memory_consumption(interior_ranges_data);
+      memory += MemoryConsumption::memory_consumption(boundary_ranges_data);
       memory += MemoryConsumption::memory_consumption(
         import_indices_chunks_by_rank_data);
       memory +=
@@ -517,6 +525,39 @@ namespace Utilities
 
 
 
+    void
+    Partitioner::initialize_interior_and_boundary_ranges()
+    {
+      boundary_ranges_data = import_indices_data;
+      std::sort(boundary_ranges_data.begin(), boundary_ranges_data.end());
+
+      // merge overlapping or adjacent ranges, which appear when an index is
+      // a ghost on several processors
+      unsigned int n_merged = 0;
+      for (const auto &range : boundary_ranges_data)
+        if (n_merged > 0 &&
+            range.first <= boundary_ranges_data[n_merged - 1].second)
+          boundary_ranges_data[n_merged - 1].second =
+            std::max(boundary_ranges_data[n_merged - 1].second, range.second);
+        else
+          boundary_ranges_data[n_merged++] = range;
+      boundary_ranges_data.resize(n_merged);
+
+      // the interior ranges are the gaps between the boundary ranges
+      interior_ranges_data.clear();
+      unsigned int next_index = 0;
+      for (const auto &range : boundary_ranges_data)
+        {
+          if (range.first > next_index)
+            interior_ranges_data.emplace_back(next_index, range.first);
+          next_index = range.second;
+        }
+      if (locally_owned_size() > next_index)
+        interior_ranges_data.emplace_back(next_index, locally_owned_size());
+    }
+
+
+
     void
     Partitioner::initialize_import_indices_plain_dev() const
     {
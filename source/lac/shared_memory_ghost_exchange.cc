@@ -0,0 +1,239 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+#include <deal.II/base/index_set.h>
+
+#include <deal.II/lac/shared_memory_ghost_exchange.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+#ifdef DEAL_II_WITH_MPI
+
+namespace internal
+{
+  namespace LinearAlgebraDistributedVector
+  {
+    SharedMemoryGhostExchange::SharedMemoryGhostExchange(
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const MPI_Comm                                            comm_sm)
+      : comm_sm(comm_sm)
+    {
+      const MPI_Comm comm = partitioner->get_mpi_communicator();
+
+      // ranks within comm of the processes in comm_sm, ordered by their rank
+      // within comm_sm
+      const std::vector<unsigned int> sm_ranks =
+        Utilities::MPI::mpi_processes_within_communicator(comm, comm_sm);
+      const auto rank_within_sm = [&](const unsigned int rank) {
+        const auto ptr = std::find(sm_ranks.begin(), sm_ranks.end(), rank);
+        return ptr == sm_ranks.end() ?
+                 numbers::invalid_unsigned_int :
+                 static_cast<unsigned int>(ptr - sm_ranks.begin());
+      };
+
+      const std::vector<types::global_dof_index> first_owned_sm =
+        Utilities::MPI::all_gather(comm_sm, partitioner->local_range().first);
+
+      // the ghost indices are sorted, with the ones owned by the same
+      // process forming a contiguous range in the order of ghost_targets()
+      const std::vector<types::global_dof_index> ghost_indices =
+        partitioner->ghost_indices().get_index_vector();
+      IndexSet remote_ghost_indices(partitioner->size());
+
+      // position of the ghost values owned by each process of comm_sm within
+      // the data of this process
+      std::vector<unsigned int> ghost_positions(sm_ranks.size(),
+                                                numbers::invalid_unsigned_int);
+
+      ghost_ptr_sm = {0};
+      unsigned int offset = 0;
+      for (const auto &[rank, n_indices] : partitioner->ghost_targets())
+        {
+          const unsigned int rank_sm = rank_within_sm(rank);
+          if (rank_sm == numbers::invalid_unsigned_int)
+            {
+              remote_ghost_ranges.emplace_back(offset, n_indices);
+              remote_ghost_indices.add_indices(ghost_indices.begin() + offset,
+                                               ghost_indices.begin() + offset +
+                                                 n_indices);
+            }
+          else
+            {
+              ghost_ranks_sm.push_back(rank_sm);
+              ghost_offsets_sm.push_back(offset);
+              for (unsigned int i = offset; i < offset + n_indices; ++i)
+                ghost_indices_sm.push_back(ghost_indices[i] -
+                                           first_owned_sm[rank_sm]);
+              ghost_ptr_sm.push_back(ghost_indices_sm.size());
+              ghost_positions[rank_sm] =
+                partitioner->locally_owned_size() + offset;
+            }
+          offset += n_indices;
+        }
+      remote_ghost_indices.compress();
+
+      // tell each owner where the ghost values it owns are stored
+      std::vector<unsigned int> import_positions(sm_ranks.size());
+
+      const int ierr = MPI_Alltoall(ghost_positions.data(),
+                                    1,
+                                    MPI_UNSIGNED,
+                                    import_positions.data(),
+                                    1,
+                                    MPI_UNSIGNED,
+                                    comm_sm);
+      AssertThrowMPI(ierr);
+
+      // the import indices are in the order of import_targets(), and for
+      // each target in the same order as the ghost indices of that target
+      std::vector<unsigned int> import_indices;
+      for (const auto &[first, last] : partitioner->import_indices())
+        for (unsigned int i = first; i < last; ++i)
+          import_indices.push_back(i);
+
+      import_ptr_sm = {0};
+      offset        = 0;
+      for (const auto &[rank, n_indices] : partitioner->import_targets())
+        {
+          const unsigned int rank_sm = rank_within_sm(rank);
+          if (rank_sm != numbers::invalid_unsigned_int)
+            {
+              Assert(import_positions[rank_sm] != numbers::invalid_unsigned_int,
+                     ExcInternalError());
+              import_ranks_sm.push_back(rank_sm);
+              import_offsets_sm.push_back(import_positions[rank_sm]);
+              import_indices_sm.insert(import_indices_sm.end(),
+                                       import_indices.begin() + offset,
+                                       import_indices.begin() + offset +
+                                         n_indices);
+              import_ptr_sm.push_back(import_indices_sm.size());
+            }
+          offset += n_indices;
+        }
+
+      remote_partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+        partitioner->locally_owned_range(), remote_ghost_indices, comm);
+    }
+
+
+
+    unsigned int
+    SharedMemoryGhostExchange::buffer_size() const
+    {
+      return remote_partitioner->n_import_indices() +
+             remote_partitioner->n_ghost_indices();
+    }
+
+
+
+    void
+    SharedMemoryGhostExchange::start_signals(
+      const std::vector<unsigned int> &readers,
+      const std::vector<unsigned int> &read_from,
+      const int                        tag,
+      std::vector<MPI_Request>        &sm_requests) const
+    {
+      Assert(sm_requests.empty(),
+             ExcMessage("Another exchange seems to still be running. Call "
+                        "the respective finish function first."));
+
+      // the requests are ordered as: ready signals to the readers, ready
+      // signals from the processes read from, done signals from the readers,
+      // and done signals to the processes read from
+      const unsigned int n_readers = readers.size();
+      sm_requests.resize(2 * (n_readers + read_from.size()));
+
+      // the done signals use the second half of the tags of the channel
+      const int done_tag = tag + 200;
+
+      for (unsigned int i = 0; i < n_readers; ++i)
+        {
+          int ierr = MPI_Isend(
+            nullptr, 0, MPI_BYTE, readers[i], tag, comm_sm, &sm_requests[i]);
+          AssertThrowMPI(ierr);
+
+          ierr = MPI_Irecv(nullptr,
+                           0,
+                           MPI_BYTE,
+                           readers[i],
+                           done_tag,
+                           comm_sm,
+                           &sm_requests[n_readers + read_from.size() + i]);
+          AssertThrowMPI(ierr);
+        }
+
+      for (unsigned int i = 0; i < read_from.size(); ++i)
+        {
+          int ierr = MPI_Irecv(nullptr,
+                               0,
+                               MPI_BYTE,
+                               read_from[i],
+                               tag,
+                               comm_sm,
+                               &sm_requests[n_readers + i]);
+          AssertThrowMPI(ierr);
+
+          ierr =
+            MPI_Send_init(nullptr,
+                          0,
+                          MPI_BYTE,
+                          read_from[i],
+                          done_tag,
+                          comm_sm,
+                          &sm_requests[2 * n_readers + read_from.size() + i]);
+          AssertThrowMPI(ierr);
+        }
+    }
+
+
+
+    void
+    SharedMemoryGhostExchange::signal_done(
+      const unsigned int        i,
+      const unsigned int        n_readers,
+      std::vector<MPI_Request> &sm_requests) const
+    {
+      const unsigned int position = sm_requests.size() / 2 + n_readers + i;
+      AssertIndexRange(position, sm_requests.size());
+
+      const int ierr = MPI_Start(&sm_requests[position]);
+      AssertThrowMPI(ierr);
+    }
+
+
+
+    void
+    SharedMemoryGhostExchange::finish_signals(
+      std::vector<MPI_Request> &sm_requests) const
+    {
+      int ierr = MPI_Waitall(sm_requests.size(),
+                             sm_requests.data(),
+                             MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+
+      // the persistent requests are not freed by MPI_Waitall()
+      for (auto &request : sm_requests)
+        if (request != MPI_REQUEST_NULL)
+          {
+            ierr = MPI_Request_free(&request);
+            AssertThrowMPI(ierr);
+          }
+      sm_requests.clear();
+    }
+  } // namespace LinearAlgebraDistributedVector
+} // namespace internal
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
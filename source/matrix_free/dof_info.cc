@@ -23,7 +23,9 @@
 #include <deal.II/matrix_free/dof_info.templates.h>
 #include <deal.II/matrix_free/vector_data_exchange.h>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -63,6 +65,9 @@ namespace internal
       row_starts_plain_indices.clear();
       plain_dof_indices.clear();
       dof_indices_interleaved.clear();
+      dof_indices_interleaved_compressed.clear();
+      dof_indices_interleaved_compressed_start.clear();
+      row_starts_interleaved_compressed.clear();
       for (unsigned int i = 0; i < 3; ++i)
         {
           index_storage_variants[i].clear();
@@ -891,6 +896,78 @@ namespace internal
                   *interleaved_dof_indices = *my_dof_indices;
               }
           }
+
+      // Step 5: For a reasonable numbering of the unknowns, the indices
+      // within a batch of cells span a small range. Then, we can store them
+      // as 16-bit offsets to the smallest index of the batch, which halves
+      // the amount of index data loaded in the cell loop. If all interleaved
+      // batches can be represented like this, the 32-bit interleaved indices
+      // are not needed any more.
+      dof_indices_interleaved_compressed.clear();
+      dof_indices_interleaved_compressed_start.assign(
+        irregular_cells.size(), numbers::invalid_unsigned_int);
+      row_starts_interleaved_compressed.assign(irregular_cells.size(),
+                                               numbers::invalid_unsigned_int);
+      bool         all_interleaved_compressed = true;
+      unsigned int n_compressed_indices       = 0;
+      for (unsigned int i = 0; i < irregular_cells.size(); ++i)
+        if (index_storage_variants[dof_access_cell][i] ==
+            IndexStorageVariants::interleaved)
+          {
+            const unsigned int *begin =
+              this->dof_indices_interleaved.data() +
+              row_starts[i * vectorization_length * n_components].first;
+            const unsigned int *end =
+              this->dof_indices_interleaved.data() +
+              row_starts[(i + 1) * vectorization_length * n_components].first;
+            if (begin == end)
+              continue;
+
+            const auto [min_index, max_index] =
+              std::minmax_element(begin, end);
+            if (*max_index - *min_index >
+                std::numeric_limits<unsigned short>::max())
+              {
+                all_interleaved_compressed = false;
+                continue;
+              }
+
+            dof_indices_interleaved_compressed_start[i] = *min_index;
+            row_starts_interleaved_compressed[i]        = n_compressed_indices;
+            n_compressed_indices += end - begin;
+          }
+
+      // only allocate the storage for the batches that are compressed
+      dof_indices_interleaved_compressed.resize(n_compressed_indices);
+      for (unsigned int i = 0; i < irregular_cells.size(); ++i)
+        if (dof_indices_interleaved_compressed_start[i] !=
+            numbers::invalid_unsigned_int)
+          {
+            const unsigned int *begin =
+              this->dof_indices_interleaved.data() +
+              row_starts[i * vectorization_length * n_components].first;
+            const unsigned int *end =
+              this->dof_indices_interleaved.data() +
+              row_starts[(i + 1) * vectorization_length * n_components].first;
+            unsigned short *compressed =
+              dof_indices_interleaved_compressed.data() +
+              row_starts_interleaved_compressed[i];
+            for (const unsigned int *index = begin; index != end;
+                 ++index, ++compressed)
+              *compressed =
+                *index - dof_indices_interleaved_compressed_start[i];
+          }
+
+      if (all_interleaved_compressed)
+        {
+          dof_indices_interleaved.clear();
+          dof_indices_interleaved.shrink_to_fit();
+        }
+      if (dof_indices_interleaved_compressed.empty())
+        {
+          dof_indices_interleaved_compressed_start.clear();
+          row_starts_interleaved_compressed.clear();
+        }
     }
 
 
@@ -1533,6 +1610,12 @@ namespace internal
         (row_starts.capacity() * sizeof(std::pair<unsigned int, unsigned int>));
       memory += MemoryConsumption::memory_consumption(dof_indices);
       memory += MemoryConsumption::memory_consumption(dof_indices_interleaved);
+      memory += MemoryConsumption::memory_consumption(
+        dof_indices_interleaved_compressed);
+      memory += MemoryConsumption::memory_consumption(
+        dof_indices_interleaved_compressed_start);
+      memory += MemoryConsumption::memory_consumption(
+        row_starts_interleaved_compressed);
       memory += MemoryConsumption::memory_consumption(dof_indices_contiguous);
       memory +=
         MemoryConsumption::memory_consumption(dof_indices_contiguous_sm);
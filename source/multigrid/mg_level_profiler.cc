@@ -0,0 +1,216 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/multigrid/mg_level_profiler.h>
+
+#include <boost/io/ios_state.hpp>
+
+#include <iomanip>
+#include <string>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace
+{
+  /**
+   * Names of the phases as printed by MGLevelProfiler::print_summary().
+   */
+  const std::array<const char *, 9> phase_names = {{"pre-smoothing",
+                                                    "residual",
+                                                    "restriction",
+                                                    "coarse solve",
+                                                    "prolongation",
+                                                    "edge prolongation",
+                                                    "post-smoothing",
+                                                    "transfer to mg",
+                                                    "transfer to global"}};
+} // namespace
+
+
+
+MGLevelProfiler::MGLevelProfiler(const MPI_Comm mpi_communicator)
+  : mpi_communicator(mpi_communicator)
+{}
+
+
+
+MGLevelProfiler::~MGLevelProfiler()
+{
+  disconnect();
+}
+
+
+
+void
+MGLevelProfiler::disconnect()
+{
+  for (auto &connection : connections)
+    connection.disconnect();
+  connections.clear();
+}
+
+
+
+void
+MGLevelProfiler::reset()
+{
+  level_data.clear();
+  transfer_data = {};
+}
+
+
+
+void
+MGLevelProfiler::record(const bool         before,
+                        const Phase        phase,
+                        const unsigned int level)
+{
+  const unsigned int index = static_cast<unsigned int>(phase);
+
+  PhaseData *data = nullptr;
+  if (index < n_level_phases)
+    {
+      if (level >= level_data.size())
+        level_data.resize(level + 1);
+      data = &level_data[level][index];
+    }
+  else
+    data = &transfer_data[index - n_level_phases];
+
+  if (before)
+    data->start_time = std::chrono::steady_clock::now();
+  else
+    {
+      data->wall_time += std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - data->start_time)
+                           .count();
+      ++data->n_calls;
+    }
+}
+
+
+
+const MGLevelProfiler::PhaseData *
+MGLevelProfiler::get_data(const Phase phase, const unsigned int level) const
+{
+  const unsigned int index = static_cast<unsigned int>(phase);
+
+  if (index >= n_level_phases)
+    return &transfer_data[index - n_level_phases];
+  else if (level < level_data.size())
+    return &level_data[level][index];
+  else
+    return nullptr;
+}
+
+
+
+double
+MGLevelProfiler::get_wall_time(const Phase        phase,
+                               const unsigned int level) const
+{
+  const PhaseData *data = get_data(phase, level);
+  return data != nullptr ? data->wall_time : 0.;
+}
+
+
+
+unsigned long long int
+MGLevelProfiler::get_n_calls(const Phase        phase,
+                             const unsigned int level) const
+{
+  const PhaseData *data = get_data(phase, level);
+  return data != nullptr ? data->n_calls : 0;
+}
+
+
+
+void
+MGLevelProfiler::print_summary(std::ostream &out) const
+{
+  const unsigned int n_levels =
+    Utilities::MPI::max(static_cast<unsigned int>(level_data.size()),
+                        mpi_communicator);
+
+  // collect the data of all phases in the order level by level, followed by
+  // the transfer phases, in order to use a single reduction
+  std::vector<double>                 wall_times;
+  std::vector<unsigned long long int> n_calls;
+  for (unsigned int level = 0; level < n_levels; ++level)
+    for (unsigned int p = 0; p < n_level_phases; ++p)
+      {
+        wall_times.push_back(get_wall_time(static_cast<Phase>(p), level));
+        n_calls.push_back(get_n_calls(static_cast<Phase>(p), level));
+      }
+  for (const auto &data : transfer_data)
+    {
+      wall_times.push_back(data.wall_time);
+      n_calls.push_back(data.n_calls);
+    }
+
+  const std::vector<Utilities::MPI::MinMaxAvg> statistics =
+    Utilities::MPI::min_max_avg(wall_times, mpi_communicator);
+  const std::vector<unsigned long long int> max_n_calls =
+    Utilities::MPI::max(n_calls, mpi_communicator);
+
+  if (Utilities::MPI::this_mpi_process(mpi_communicator) != 0)
+    return;
+
+  // we are going to change the precision and width of output below. store
+  // the old values so they get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out);
+
+  const std::string separator = "+-------+--------------------+---------+"
+                                "------------+------------+------------+\n";
+
+  const auto print_row = [&](const std::string &level,
+                             const unsigned int phase,
+                             const unsigned int index) {
+    out << "| " << std::setw(5) << std::right << level << " | " << std::left
+        << std::setw(18) << phase_names[phase] << " | " << std::right
+        << std::setw(7) << max_n_calls[index];
+    for (const double time : {statistics[index].min,
+                              statistics[index].avg,
+                              statistics[index].max})
+      out << " | " << std::setw(9) << std::setprecision(4) << time << 's';
+    out << " |\n";
+  };
+
+  out << '\n'
+      << separator << "| " << std::left << std::setw(75)
+      << ("Multigrid wall time per level and phase over " +
+          std::to_string(
+            Utilities::MPI::n_mpi_processes(mpi_communicator)) +
+          " processes")
+      << " |\n"
+      << separator << "| level | phase              |   calls |"
+      << "   min time |   avg time |   max time |\n"
+      << separator;
+
+  for (unsigned int level = n_levels; level-- > 0;)
+    for (unsigned int p = 0; p < n_level_phases; ++p)
+      if (max_n_calls[level * n_level_phases + p] > 0)
+        print_row(std::to_string(level), p, level * n_level_phases + p);
+
+  for (unsigned int p = 0; p < transfer_data.size(); ++p)
+    if (max_n_calls[n_levels * n_level_phases + p] > 0)
+      print_row("", n_level_phases + p, n_levels * n_level_phases + p);
+
+  out << separator << std::endl;
+}
+
+DEAL_II_NAMESPACE_CLOSE
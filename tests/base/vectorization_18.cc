@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// test the gather operation of vectorized array with 16-bit offsets,
+// including offsets that do not fit into a signed 16-bit integer
+
+#include <deal.II/base/vectorization.h>
+
+#include <cstdint>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test()
+{
+  std::vector<Number> vec(70000);
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    vec[i] = i % 1000 + 1;
+
+  const unsigned int n_vectors = VectorizedArray<Number>::size();
+  std::uint16_t      offsets[n_vectors];
+  for (unsigned int i = 0; i < n_vectors; ++i)
+    offsets[i] = 65535 - 4097 * i;
+
+  for (const unsigned int start : {0U, 3U})
+    {
+      VectorizedArray<Number> arr;
+      arr = Number(-1000);
+      arr.gather(&vec[start], offsets);
+
+      unsigned int n_errors = 0;
+      for (unsigned int i = 0; i < n_vectors; ++i)
+        if (arr[i] != vec[start + offsets[i]])
+          ++n_errors;
+      deallog << "gather 16-bit offsets #errors: " << n_errors << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("double");
+  test<double>();
+  deallog.pop();
+  deallog.push("float");
+  test<float>();
+  deallog.pop();
+  deallog.push("long double");
+  test<long double>();
+  deallog.pop();
+}
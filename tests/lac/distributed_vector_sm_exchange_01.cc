@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// Test LinearAlgebra::distributed::Vector::enable_shared_memory_ghost_exchange()
+// by comparing update_ghost_values() and compress(VectorOperation::add)
+// against the default point-to-point exchange, both with all processes in
+// one shared-memory domain and with two emulated shared-memory domains.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  AssertDimension(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), 4);
+
+  const auto my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  MPI_Comm sm_comm;
+  MPI_Comm_split_type(
+    MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &sm_comm);
+  AssertDimension(Utilities::MPI::n_mpi_processes(sm_comm), 4);
+
+  // emulate two shared-memory domains with two processes each
+  MPI_Comm pair_comm;
+  MPI_Comm_split(MPI_COMM_WORLD, my_rank / 2, my_rank, &pair_comm);
+
+  // each process owns 10 entries and imports a few entries from each of
+  // the other processes
+  IndexSet is_local(40);
+  is_local.add_range(10 * my_rank, 10 * (my_rank + 1));
+  IndexSet is_ghost(40);
+  for (unsigned int p = 0; p < 4; ++p)
+    if (p != my_rank)
+      {
+        is_ghost.add_index(10 * p + (my_rank + 1) % 10);
+        is_ghost.add_index(10 * p + 5);
+        is_ghost.add_index(10 * p + 9 - my_rank);
+      }
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(is_local,
+                                                  is_ghost,
+                                                  MPI_COMM_WORLD);
+
+  const auto test = [&](const MPI_Comm comm) {
+    LinearAlgebra::distributed::Vector<double> reference(partitioner);
+    LinearAlgebra::distributed::Vector<double> vector;
+    vector.reinit(partitioner, comm);
+    vector.enable_shared_memory_ghost_exchange();
+
+    // ghost values
+    for (unsigned int i = 0; i < partitioner->locally_owned_size(); ++i)
+      {
+        reference.local_element(i) = 100 * my_rank + i;
+        vector.local_element(i)    = 100 * my_rank + i;
+      }
+
+    for (unsigned int cycle = 0; cycle < 2; ++cycle)
+      {
+        reference.update_ghost_values();
+        vector.update_ghost_values();
+
+        bool ghosts_match = true;
+        for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+          ghosts_match &=
+            (vector.local_element(partitioner->locally_owned_size() + i) ==
+             reference.local_element(partitioner->locally_owned_size() + i));
+        deallog << "ghost values match: " << ghosts_match << std::endl;
+
+        reference.zero_out_ghost_values();
+        vector.zero_out_ghost_values();
+        vector *= 2.;
+        reference *= 2.;
+      }
+
+    // compress
+    for (unsigned int cycle = 0; cycle < 2; ++cycle)
+      {
+        for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+          {
+            const unsigned int index = partitioner->locally_owned_size() + i;
+            reference.local_element(index) = 1 + my_rank + i;
+            vector.local_element(index)    = 1 + my_rank + i;
+          }
+        reference.compress(VectorOperation::add);
+        vector.compress(VectorOperation::add);
+
+        bool owned_match = true;
+        for (unsigned int i = 0; i < partitioner->locally_owned_size(); ++i)
+          owned_match &= (vector.local_element(i) == reference.local_element(i));
+        bool ghosts_zero = true;
+        for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+          ghosts_zero &=
+            (vector.local_element(partitioner->locally_owned_size() + i) == 0.);
+        deallog << "compress matches: " << owned_match
+                << ", ghosts zeroed: " << ghosts_zero << std::endl;
+      }
+
+    // a copy shares the exchange pattern
+    LinearAlgebra::distributed::Vector<double> copy;
+    copy.reinit(vector);
+    copy = vector;
+    copy.update_ghost_values();
+    reference.update_ghost_values();
+    bool copy_match = true;
+    for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+      copy_match &=
+        (copy.local_element(partitioner->locally_owned_size() + i) ==
+         reference.local_element(partitioner->locally_owned_size() + i));
+    deallog << "copy ghost values match: " << copy_match << std::endl;
+  };
+
+  test(sm_comm);
+  test(pair_comm);
+
+  MPI_Comm_free(&pair_comm);
+  MPI_Comm_free(&sm_comm);
+}
@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check LinearAlgebra::FusedVectorOperations against the individual vector
+// operations for Vector, LinearAlgebra::distributed::Vector, and BlockVector
+// (which runs through the fallback using the functions of the vector)
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/fused_vector_operations.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename VectorType>
+void
+fill(VectorType &v, const unsigned int seed)
+{
+  for (unsigned int i = 0; i < v.size(); ++i)
+    v(i) = std::sin(1. + seed + 0.37 * i * (seed + 1));
+}
+
+
+
+template <typename VectorType>
+void
+test(const VectorType &model)
+{
+  using Number = typename VectorType::value_type;
+
+  VectorType x(model), r(model), p(model), v(model), w(model);
+  fill(x, 0);
+  fill(r, 1);
+  fill(p, 2);
+  fill(v, 3);
+  fill(w, 4);
+  VectorType x_ref(x), r_ref(r), p_ref(p);
+
+  const Number alpha = 0.3, beta = -1.7, omega = 0.6;
+
+  LinearAlgebra::FusedVectorOperations<VectorType> operations;
+  operations.sadd(p, beta, 1., r, -beta * omega, v);
+  operations.add(x, alpha, p).add(r, -alpha, v);
+  const unsigned int r_dot_r = operations.dot(r, r);
+  const unsigned int r_dot_w = operations.dot(r, w);
+  const unsigned int p_dot_x = operations.dot(p, x);
+  const std::vector<Number> results = operations.execute();
+
+  p_ref.sadd(beta, 1., r_ref);
+  p_ref.add(-beta * omega, v);
+  x_ref.add(alpha, p_ref);
+  r_ref.add(-alpha, v);
+
+  const double tolerance = 100. * std::numeric_limits<Number>::epsilon();
+  deallog << "Number of results: " << results.size() << std::endl;
+  deallog << "Error r.r ok: "
+          << (std::abs(results[r_dot_r] - r_ref * r_ref) <
+              tolerance * (r_ref * r_ref))
+          << std::endl;
+  deallog << "Error r.w ok: "
+          << (std::abs(results[r_dot_w] - r_ref * w) <
+              tolerance * r_ref.l2_norm() * w.l2_norm())
+          << std::endl;
+  deallog << "Error p.x ok: "
+          << (std::abs(results[p_dot_x] - p_ref * x_ref) <
+              tolerance * p_ref.l2_norm() * x_ref.l2_norm())
+          << std::endl;
+
+  x -= x_ref;
+  r -= r_ref;
+  p -= p_ref;
+  deallog << "Error vectors ok: "
+          << (x.linfty_norm() + r.linfty_norm() + p.linfty_norm() < tolerance)
+          << std::endl;
+
+  // assignment and update of two vectors, the first without reading the old
+  // content of the destination vector
+  operations.equ(w, 2., x_ref).sadd(v, 0., 1., r_ref, -1., p_ref);
+  operations.sadd(x_ref, 0.5, 1., r_ref, 2., p_ref);
+  const unsigned int w_dot_v = operations.dot(w, v);
+  const Number       w_dot_v_fused = operations.execute()[w_dot_v];
+  deallog << "Error equ/sadd ok: "
+          << (std::abs(w_dot_v_fused - w * v) <
+              tolerance * w.l2_norm() * v.l2_norm())
+          << std::endl;
+
+  // an empty set of operations
+  deallog << "Empty: " << operations.execute().size() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  for (const unsigned int size : {7U, 1000U, 34567U})
+    {
+      deallog << "Size " << size << std::endl;
+      {
+        deallog.push("Vector<double>");
+        test(Vector<double>(size));
+        deallog.pop();
+      }
+      {
+        deallog.push("Vector<float>");
+        test(Vector<float>(size));
+        deallog.pop();
+      }
+      {
+        deallog.push("distributed::Vector<double>");
+        test(LinearAlgebra::distributed::Vector<double>(size));
+        deallog.pop();
+      }
+      {
+        deallog.push("BlockVector<double>");
+        test(BlockVector<double>(std::vector<types::global_dof_index>{
+          size / 2, size - size / 2}));
+        deallog.pop();
+      }
+    }
+}
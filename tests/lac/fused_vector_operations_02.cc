@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check that SolverCG and SolverBicgstab, which update the solution through
+// LinearAlgebra::FusedVectorOperations, work with a solution vector that has
+// ghost elements, giving the same result as without ghost elements and
+// keeping the ghost values up to date
+
+#include <deal.II/base/index_set.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_bicgstab.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+// finite difference discretization of -u'' + u in 1d with the entries of
+// the vectors distributed in contiguous blocks among the processes
+class LaplaceOperator
+{
+public:
+  LaplaceOperator(const IndexSet &owned, const IndexSet &relevant)
+    : src_ghosted(owned, relevant, MPI_COMM_WORLD)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    src_ghosted.copy_locally_owned_data_from(src);
+    src_ghosted.update_ghost_values();
+    for (const auto i : dst.locally_owned_elements())
+      {
+        double value = 3. * src_ghosted(i);
+        if (i > 0)
+          value -= src_ghosted(i - 1);
+        if (i + 1 < dst.size())
+          value -= src_ghosted(i + 1);
+        dst(i) = value;
+      }
+  }
+
+private:
+  mutable VectorType src_ghosted;
+};
+
+
+
+template <typename SolverType>
+void
+test(const IndexSet &owned, const IndexSet &relevant)
+{
+  const LaplaceOperator matrix(owned, relevant);
+
+  VectorType rhs(owned, MPI_COMM_WORLD);
+  for (const auto i : owned)
+    rhs(i) = 1. + 0.1 * (i % 7);
+
+  SolverControl control(200, 1e-10 * rhs.l2_norm(), false, false);
+
+  VectorType solution(owned, MPI_COMM_WORLD);
+  SolverType(control).solve(matrix, solution, rhs, PreconditionIdentity());
+  const unsigned int n_iterations = control.last_step();
+
+  VectorType solution_ghosted(owned, relevant, MPI_COMM_WORLD);
+  solution_ghosted.update_ghost_values();
+  SolverType(control).solve(matrix,
+                            solution_ghosted,
+                            rhs,
+                            PreconditionIdentity());
+
+  deallog << "Same number of iterations: "
+          << (control.last_step() == n_iterations) << std::endl;
+  deallog << "Solution still has ghost elements: "
+          << solution_ghosted.has_ghost_elements() << std::endl;
+
+  // compare the ghost entries with the values on the owning processes
+  VectorType reference(owned, relevant, MPI_COMM_WORLD);
+  reference.copy_locally_owned_data_from(solution_ghosted);
+  reference.update_ghost_values();
+  bool ghosts_up_to_date = true;
+  for (const auto i : relevant)
+    if (solution_ghosted(i) != reference(i))
+      ghosts_up_to_date = false;
+  deallog << "Ghost values up to date: "
+          << (Utilities::MPI::min(ghosts_up_to_date ? 1 : 0,
+                                  MPI_COMM_WORLD) == 1)
+          << std::endl;
+
+  solution_ghosted.zero_out_ghost_values();
+  solution -= solution_ghosted;
+  deallog << "Same solution: "
+          << (solution.linfty_norm() < 1e-12 * solution_ghosted.linfty_norm())
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  mpi_initlog();
+
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const unsigned int my_id   = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  const unsigned int n_local = 40;
+  const unsigned int size    = n_local * n_procs;
+
+  IndexSet owned(size);
+  owned.add_range(my_id * n_local, (my_id + 1) * n_local);
+  IndexSet relevant(owned);
+  if (my_id > 0)
+    relevant.add_index(my_id * n_local - 1);
+  if (my_id + 1 < n_procs)
+    relevant.add_index((my_id + 1) * n_local);
+
+  deallog.push("cg");
+  test<SolverCG<VectorType>>(owned, relevant);
+  deallog.pop();
+
+  deallog.push("bicgstab");
+  test<SolverBicgstab<VectorType>>(owned, relevant);
+  deallog.pop();
+}
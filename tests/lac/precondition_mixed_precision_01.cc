@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// test PreconditionMixedPrecision: solve a finite difference problem to an
+// accuracy beyond single precision with outer double-precision solvers, with
+// all inner iterations done on a SparseMatrix<float>
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/precondition_mixed_precision.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/solver_richardson.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename SolverType, typename PreconditionerType>
+void
+solve_and_check(const SparseMatrix<double> &A,
+                const Vector<double>       &f,
+                const PreconditionerType   &preconditioner,
+                const std::string          &name)
+{
+  Vector<double> u(f.size());
+  SolverControl  control(100, 1e-12 * f.l2_norm());
+  SolverType     solver(control);
+
+  deallog << name << std::endl;
+  check_solver_within_range(solver.solve(A, u, f, preconditioner),
+                            control.last_step(),
+                            2,
+                            12);
+
+  Vector<double> residual(f.size());
+  A.vmult(residual, u);
+  residual -= f;
+  deallog << "Residual below tolerance: "
+          << (residual.l2_norm() < 1.01e-12 * f.l2_norm() ? "yes" : "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  SparseMatrix<float> A_float(sparsity);
+  A_float.copy_from(A);
+
+  Vector<double> f(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    f(i) = 1. + 0.01 * (i % 7);
+
+  PreconditionJacobi<SparseMatrix<float>> inner_preconditioner;
+  inner_preconditioner.initialize(A_float);
+
+  using Preconditioner =
+    PreconditionMixedPrecision<SparseMatrix<float>,
+                               PreconditionJacobi<SparseMatrix<float>>>;
+  Preconditioner preconditioner;
+  preconditioner.initialize(A_float,
+                            inner_preconditioner,
+                            Preconditioner::AdditionalData(200, 1e-4));
+
+  solve_and_check<SolverRichardson<Vector<double>>>(A,
+                                                    f,
+                                                    preconditioner,
+                                                    "Richardson");
+  solve_and_check<SolverFGMRES<Vector<double>>>(A,
+                                                f,
+                                                preconditioner,
+                                                "FGMRES");
+  solve_and_check<SolverFlexibleCG<Vector<double>>>(A,
+                                                    f,
+                                                    preconditioner,
+                                                    "FlexibleCG");
+
+  // check that the inner solver stops after the given number of iterations
+  // without throwing an exception
+  preconditioner.initialize(A_float,
+                            inner_preconditioner,
+                            Preconditioner::AdditionalData(5, 1e-4));
+  Vector<double> u(dim);
+  preconditioner.vmult(u, f);
+  deallog << "Inner iterations with limit 5: "
+          << preconditioner.last_n_inner_iterations() << std::endl;
+}
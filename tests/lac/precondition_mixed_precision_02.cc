@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// like precondition_mixed_precision_01, but with
+// LinearAlgebra::distributed::Vector. Also check the matrix-vector product
+// of a SparseMatrix<float> with vectors of type
+// LinearAlgebra::distributed::Vector<double>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/precondition_mixed_precision.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+int
+main()
+{
+  initlog();
+
+  using VectorType      = LinearAlgebra::distributed::Vector<double>;
+  using InnerVectorType = LinearAlgebra::distributed::Vector<float>;
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  SparseMatrix<float> A_float(sparsity);
+  A_float.copy_from(A);
+
+  VectorType f(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    f(i) = 1. + 0.01 * (i % 7);
+
+  // product of the float matrix with double vectors
+  {
+    VectorType result(dim), result_double(dim);
+    A_float.vmult(result, f);
+    A.vmult(result_double, f);
+    result -= result_double;
+    deallog << "Difference float/double vmult small: "
+            << (result.linfty_norm() < 1e-6 * result_double.linfty_norm() ?
+                  "yes" :
+                  "no")
+            << std::endl;
+  }
+
+  PreconditionIdentity inner_preconditioner;
+
+  PreconditionMixedPrecision<SparseMatrix<float>,
+                             PreconditionIdentity,
+                             SolverCG<InnerVectorType>>
+    preconditioner;
+  preconditioner.initialize(A_float, inner_preconditioner);
+
+  VectorType               u(dim);
+  SolverControl            control(100, 1e-12 * f.l2_norm());
+  SolverFGMRES<VectorType> solver(control);
+  check_solver_within_range(solver.solve(A, u, f, preconditioner),
+                            control.last_step(),
+                            2,
+                            12);
+
+  VectorType residual(dim);
+  A.vmult(residual, u);
+  residual -= f;
+  deallog << "Residual below tolerance: "
+          << (residual.l2_norm() < 1.01e-12 * f.l2_norm() ? "yes" : "no")
+          << std::endl;
+}
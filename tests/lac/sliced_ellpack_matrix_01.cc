@@ -0,0 +1,127 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check SlicedEllpackMatrix::vmult, vmult_add, Tvmult, Tvmult_add and
+// precondition_Jacobi against the result of SparseMatrix, for a matrix with
+// rows of very different length and several sorting scopes sigma
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename number>
+void
+check_vector(const Vector<number> &result,
+             const Vector<number> &reference,
+             const std::string    &name)
+{
+  Vector<number> diff(result);
+  diff -= reference;
+  AssertThrow(diff.linfty_norm() <=
+                100 * std::numeric_limits<number>::epsilon() *
+                  reference.linfty_norm(),
+              ExcInternalError());
+  deallog << name << " OK" << std::endl;
+}
+
+
+
+template <typename number>
+void
+test(const unsigned int n_rows, const unsigned int n_cols)
+{
+  // random pattern with rows of length between 1 and 20, always including
+  // the diagonal for square matrices
+  DynamicSparsityPattern dsp(n_rows, n_cols);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    {
+      if (n_rows == n_cols)
+        dsp.add(i, i);
+      const unsigned int length = 1 + Testing::rand() % 20;
+      for (unsigned int k = 0; k < length; ++k)
+        dsp.add(i, Testing::rand() % n_cols);
+    }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<number> matrix(sparsity);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (auto it = matrix.begin(i); it != matrix.end(i); ++it)
+      it->value() = (it->column() == i) ?
+                      number(30.) :
+                      number(-1.) + number(Testing::rand() % 100) / 100.;
+
+  Vector<number> src(n_cols), src_t(n_rows);
+  for (unsigned int i = 0; i < n_cols; ++i)
+    src(i) = number(Testing::rand() % 100) / 10.;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    src_t(i) = number(Testing::rand() % 100) / 10.;
+
+  for (const unsigned int sigma : {1U, 4U, 32U, n_rows})
+    {
+      deallog << "Matrix " << n_rows << " x " << n_cols << ", sigma " << sigma
+              << std::endl;
+
+      SlicedEllpackMatrix<number> sell(matrix, sigma);
+      AssertDimension(sell.m(), n_rows);
+      AssertDimension(sell.n(), n_cols);
+      AssertDimension(sell.n_nonzero_elements(),
+                      sparsity.n_nonzero_elements());
+      AssertThrow(sell.n_stored_elements() >= sell.n_nonzero_elements(),
+                  ExcInternalError());
+
+      Vector<number> dst(n_rows), ref(n_rows);
+      sell.vmult(dst, src);
+      matrix.vmult(ref, src);
+      check_vector(dst, ref, "vmult");
+
+      sell.vmult_add(dst, src);
+      matrix.vmult_add(ref, src);
+      check_vector(dst, ref, "vmult_add");
+
+      Vector<number> dst_t(n_cols), ref_t(n_cols);
+      sell.Tvmult(dst_t, src_t);
+      matrix.Tvmult(ref_t, src_t);
+      check_vector(dst_t, ref_t, "Tvmult");
+
+      sell.Tvmult_add(dst_t, src_t);
+      matrix.Tvmult_add(ref_t, src_t);
+      check_vector(dst_t, ref_t, "Tvmult_add");
+
+      if (n_rows == n_cols)
+        {
+          sell.precondition_Jacobi(dst, src, 0.8);
+          matrix.precondition_Jacobi(ref, src, 0.8);
+          check_vector(dst, ref, "precondition_Jacobi");
+        }
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<double>(1, 1);
+  test<double>(37, 37);
+  test<double>(200, 200);
+  test<double>(150, 90);
+  test<float>(101, 101);
+}
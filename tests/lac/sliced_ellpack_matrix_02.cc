@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// solve a finite difference Laplace problem with SolverCG and a Jacobi
+// preconditioner, using a SlicedEllpackMatrix as the operator, and compare
+// the solution against the one obtained with SparseMatrix
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int size : {17U, 33U})
+    {
+      const unsigned int dim = (size - 1) * (size - 1);
+      deallog << "Size " << size << " unknowns " << dim << std::endl;
+
+      FDMatrix        testproblem(size, size);
+      SparsityPattern sparsity(dim, dim, 9);
+      testproblem.nine_point_structure(sparsity);
+      sparsity.compress();
+      SparseMatrix<double> A(sparsity);
+      testproblem.nine_point(A);
+
+      SlicedEllpackMatrix<double> A_sell(A);
+
+      Vector<double> f(dim);
+      for (unsigned int i = 0; i < dim; ++i)
+        f(i) = 1. + 0.01 * (i % 7);
+
+      Vector<double> u(dim), u_ref(dim);
+
+      SolverControl            control(500, 1e-10 * f.l2_norm());
+      SolverCG<Vector<double>> solver(control);
+
+      PreconditionJacobi<SparseMatrix<double>> prec;
+      prec.initialize(A, 0.8);
+      check_solver_within_range(solver.solve(A, u_ref, f, prec),
+                                control.last_step(),
+                                10,
+                                200);
+
+      PreconditionJacobi<SlicedEllpackMatrix<double>> prec_sell;
+      prec_sell.initialize(A_sell, 0.8);
+      check_solver_within_range(solver.solve(A_sell, u, f, prec_sell),
+                                control.last_step(),
+                                10,
+                                200);
+
+      u -= u_ref;
+      deallog << "Difference to SparseMatrix solution: "
+              << (u.linfty_norm() < 1e-6 * u_ref.linfty_norm() ? "small" :
+                                                                   "large")
+              << std::endl;
+    }
+}
@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check the 16-bit column offsets of SlicedEllpackMatrix: for a matrix whose
+// rows couple to nearby columns as well as to columns far away, only part of
+// the chunks can be compressed. Check that vmult and Tvmult give the same
+// result as SparseMatrix with and without compression, and that the
+// compression reduces the memory consumption for a banded matrix
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sliced_ellpack_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+void
+check(const SparseMatrix<double> &matrix, const bool compress)
+{
+  SlicedEllpackMatrix<double> sell(matrix, 1, compress);
+
+  const unsigned int n_chunks =
+    (matrix.m() + SlicedEllpackMatrix<double>::chunk_size - 1) /
+    SlicedEllpackMatrix<double>::chunk_size;
+  deallog << "Compressed chunks: "
+          << (sell.n_chunks_with_compressed_indices() == 0 ?
+                "none" :
+                (sell.n_chunks_with_compressed_indices() == n_chunks ? "all" :
+                                                                        "some"))
+          << std::endl;
+
+  Vector<double> src(matrix.n()), dst(matrix.m()), ref(matrix.m());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = (i % 13) * 0.1 - 0.5;
+  sell.vmult(dst, src);
+  matrix.vmult(ref, src);
+  dst -= ref;
+  AssertThrow(dst.linfty_norm() < 1e-12 * ref.linfty_norm(),
+              ExcInternalError());
+
+  Vector<double> src_t(matrix.m()), dst_t(matrix.n()), ref_t(matrix.n());
+  for (unsigned int i = 0; i < src_t.size(); ++i)
+    src_t(i) = (i % 11) * 0.1 - 0.4;
+  sell.Tvmult(dst_t, src_t);
+  matrix.Tvmult(ref_t, src_t);
+  dst_t -= ref_t;
+  AssertThrow(dst_t.linfty_norm() < 1e-12 * ref_t.linfty_norm(),
+              ExcInternalError());
+
+  deallog << "vmult and Tvmult OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // banded matrix from a finite difference discretization
+  {
+    const unsigned int size = 65;
+    const unsigned int dim  = (size - 1) * (size - 1);
+    FDMatrix           testproblem(size, size);
+    SparsityPattern    sparsity(dim, dim, 9);
+    testproblem.nine_point_structure(sparsity);
+    sparsity.compress();
+    SparseMatrix<double> matrix(sparsity);
+    testproblem.nine_point(matrix);
+
+    check(matrix, true);
+    check(matrix, false);
+
+    const SlicedEllpackMatrix<double> compressed(matrix, 1, true);
+    const SlicedEllpackMatrix<double> uncompressed(matrix, 1, false);
+    deallog << "Compression reduces memory: "
+            << (compressed.memory_consumption() <
+                    uncompressed.memory_consumption() ?
+                  "yes" :
+                  "no")
+            << std::endl;
+  }
+
+  // matrix where the first half of the rows is banded and the second half
+  // also couples to the last column
+  {
+    const unsigned int     n = 200000;
+    DynamicSparsityPattern dsp(n, n);
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        dsp.add(i, i);
+        if (i > 0)
+          dsp.add(i, i - 1);
+        if (i < n - 1)
+          dsp.add(i, i + 1);
+        if (i >= n / 2)
+          dsp.add(i, n - 1);
+      }
+    dsp.add(0, n - 1);
+    SparsityPattern sparsity;
+    sparsity.copy_from(dsp);
+    SparseMatrix<double> matrix(sparsity);
+    for (unsigned int i = 0; i < n; ++i)
+      for (auto it = matrix.begin(i); it != matrix.end(i); ++it)
+        it->value() = (it->column() == i) ? 4. : -1. / (1 + (i % 5));
+
+    check(matrix, true);
+    check(matrix, false);
+  }
+}
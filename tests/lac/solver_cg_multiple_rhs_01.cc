@@ -0,0 +1,96 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// solve a finite difference Laplace problem with several right hand sides at
+// once with SolverCG and compare against separate solves
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename PreconditionerType>
+void
+test(const SparseMatrix<double>  &A,
+     const PreconditionerType    &preconditioner,
+     const unsigned int           n_vectors)
+{
+  std::vector<Vector<double>> b(n_vectors), x(n_vectors);
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      b[v].reinit(A.m());
+      x[v].reinit(A.m());
+      for (unsigned int i = 0; i < A.m(); ++i)
+        b[v](i) = 1. + 0.1 * v + 0.01 * ((i + v) % 7);
+    }
+  // make the last right hand side zero, which must be handled gracefully
+  if (n_vectors > 2)
+    b.back() = 0.;
+
+  SolverControl            control(500, 1e-10);
+  SolverCG<Vector<double>> solver(control);
+  check_solver_within_range(solver.solve(A, x, b, preconditioner),
+                            control.last_step(),
+                            10,
+                            200);
+  const unsigned int n_steps_multiple = control.last_step();
+
+  double       max_error = 0.;
+  unsigned int max_steps = 0;
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      Vector<double> ref(A.m());
+      solver.solve(A, ref, b[v], preconditioner);
+      max_steps = std::max(max_steps, control.last_step());
+      ref -= x[v];
+      max_error = std::max(max_error, ref.linfty_norm());
+    }
+  deallog << "n_vectors=" << n_vectors << " error: "
+          << (max_error < 1e-8 ? "ok" : "wrong")
+          << " steps: " << (n_steps_multiple == max_steps ? "same" : "differ")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  PreconditionIdentity identity;
+  PreconditionSSOR<>   ssor;
+  ssor.initialize(A, 1.2);
+
+  for (const unsigned int n_vectors : {1U, 4U, 9U})
+    {
+      test(A, identity, n_vectors);
+      test(A, ssor, n_vectors);
+    }
+}
@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check the single-reduction variants of SolverCG against the standard
+// algorithm for a finite difference Laplace problem, for Vector and
+// LinearAlgebra::distributed::Vector and with and without preconditioner
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+test(const SparseMatrix<double> &A, const PreconditionerType &preconditioner)
+{
+  VectorType f(A.m()), u_ref(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    f(i) = 1. + 0.01 * (i % 7);
+
+  SolverControl            control(500, 1e-10 * f.l2_norm());
+  SolverCG<VectorType> solver_ref(control);
+  solver_ref.solve(A, u_ref, f, preconditioner);
+  const unsigned int n_steps_ref = control.last_step();
+
+  using Variant = typename SolverCG<VectorType>::Variant;
+  for (const auto variant : {Variant::chronopoulos_gear, Variant::pipelined})
+    {
+      VectorType u(A.m());
+      SolverCG<VectorType> solver(
+        control, typename SolverCG<VectorType>::AdditionalData(true, variant));
+      check_solver_within_range(solver.solve(A, u, f, preconditioner),
+                                control.last_step(),
+                                n_steps_ref - 1,
+                                n_steps_ref + 1);
+      u -= u_ref;
+      deallog << "Difference to standard CG: "
+              << (u.linfty_norm() < 1e-6 * u_ref.linfty_norm() ? "small" :
+                                                                   "large")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  PreconditionIdentity identity;
+
+  Vector<double> inverse_diagonal(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    inverse_diagonal(i) = 1. / A.diag_element(i);
+  DiagonalMatrix<Vector<double>> jacobi(inverse_diagonal);
+
+  LinearAlgebra::distributed::Vector<double> inverse_diagonal_distributed(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    inverse_diagonal_distributed(i) = inverse_diagonal(i);
+  DiagonalMatrix<LinearAlgebra::distributed::Vector<double>>
+    jacobi_distributed(inverse_diagonal_distributed);
+
+  deallog.push("Vector");
+  test<Vector<double>>(A, identity);
+  test<Vector<double>>(A, jacobi);
+  deallog.pop();
+
+  deallog.push("distributed::Vector");
+  test<LinearAlgebra::distributed::Vector<double>>(A, identity);
+  test<LinearAlgebra::distributed::Vector<double>>(A, jacobi_distributed);
+  deallog.pop();
+}
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check the s-step variant of SolverGMRES against the standard Arnoldi
+// process for a convection-diffusion problem, with left and right
+// preconditioning and for Vector and LinearAlgebra::distributed::Vector
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType>
+void
+test(const SparseMatrix<double> &A, const bool right_preconditioning)
+{
+  VectorType f(A.m()), u_ref(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    f(i) = 1. + 0.01 * (i % 7);
+
+  DiagonalMatrix<VectorType> preconditioner;
+  preconditioner.get_vector().reinit(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    preconditioner.get_vector()(i) = 1. / A.diag_element(i);
+
+  using AdditionalData = typename SolverGMRES<VectorType>::AdditionalData;
+
+  SolverControl control(1000, 1e-10 * f.l2_norm());
+  {
+    SolverGMRES<VectorType> solver(control,
+                                   AdditionalData(20, right_preconditioning));
+    solver.solve(A, u_ref, f, preconditioner);
+  }
+  const unsigned int n_steps_ref = control.last_step();
+  deallog << "Standard GMRES converged in " << n_steps_ref << " iterations"
+          << std::endl;
+
+  for (const unsigned int s_step_size : {2U, 4U, 6U})
+    {
+      VectorType     u(A.m());
+      AdditionalData data(20, right_preconditioning);
+      data.s_step_size = s_step_size;
+      SolverGMRES<VectorType> solver(control, data);
+
+      // record the blocks generated by the s-step variant, which would be
+      // missing if the solver had fallen back to the standard Arnoldi process
+      unsigned int n_blocks = 0, n_block_vectors = 0, max_block_size = 0;
+      solver.connect_s_step_block_slot([&](const unsigned int block_size) {
+        ++n_blocks;
+        n_block_vectors += block_size;
+        max_block_size = std::max(max_block_size, block_size);
+      });
+      solver.solve(A, u, f, preconditioner);
+
+      // the s-step variant checks convergence once every s steps and the
+      // Newton basis changes the rounding errors, so allow for a few more
+      // iterations than the standard variant
+      deallog << "s=" << s_step_size << " converged "
+              << (control.last_step() <= n_steps_ref + 2 * s_step_size ?
+                    "in expected number of iterations" :
+                    "too slowly")
+              << std::endl;
+
+      deallog << "s=" << s_step_size << " s-step blocks used: "
+              << (n_blocks > 0 && max_block_size == s_step_size ? "yes" : "no")
+              << std::endl;
+      deallog << "s=" << s_step_size << " most steps in s-step blocks: "
+              << (2 * n_block_vectors > control.last_step() ? "yes" : "no")
+              << std::endl;
+
+      u -= u_ref;
+      deallog << "s=" << s_step_size << " difference to standard GMRES: "
+              << (u.linfty_norm() < 1e-6 * u_ref.linfty_norm() ? "small" :
+                                                                   "large")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 5);
+  testproblem.five_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.five_point(A);
+
+  // add a convection term in x direction to make the matrix non-symmetric
+  for (unsigned int row = 0; row < dim; ++row)
+    {
+      A.add(row, row, 1.);
+      if (row % (size - 1) > 0)
+        A.add(row, row - 1, -1.);
+    }
+
+  for (const bool right_preconditioning : {false, true})
+    {
+      deallog.push(right_preconditioning ? "right" : "left");
+      deallog.push("Vector");
+      test<Vector<double>>(A, right_preconditioning);
+      deallog.pop();
+      deallog.push("distributed::Vector");
+      test<LinearAlgebra::distributed::Vector<double>>(A,
+                                                       right_preconditioning);
+      deallog.pop();
+      deallog.pop();
+    }
+}
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check that the level-scheduled factorization and application of
+// SparseILU (with and without fill-in) and SparseMIC give exactly the same
+// results with one and with several threads. the seven-point stencil on a
+// cube gives levels that are large enough to be split among threads
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_mic.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+
+template <typename Preconditioner>
+Vector<double>
+apply(const SparseMatrix<double>                    &A,
+      const typename Preconditioner::AdditionalData &data,
+      const Vector<double>                          &src,
+      const unsigned int                             n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  Preconditioner preconditioner;
+  preconditioner.initialize(A, data);
+
+  Vector<double> dst(src.size());
+  preconditioner.vmult(dst, src);
+  return dst;
+}
+
+
+
+template <typename Preconditioner>
+void
+test(const std::string                             &name,
+     const SparseMatrix<double>                    &A,
+     const typename Preconditioner::AdditionalData &data)
+{
+  Vector<double> src(A.m());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  const Vector<double> serial   = apply<Preconditioner>(A, data, src, 1);
+  Vector<double>       parallel = apply<Preconditioner>(A, data, src, 4);
+
+  parallel -= serial;
+  deallog << name << ": difference between 1 and 4 threads "
+          << parallel.linfty_norm() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int n   = 32;
+  const unsigned int dim = n * n * n;
+
+  DynamicSparsityPattern dsp(dim, dim);
+  for (unsigned int k = 0; k < n; ++k)
+    for (unsigned int j = 0; j < n; ++j)
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          const unsigned int row = (k * n + j) * n + i;
+          dsp.add(row, row);
+          if (i > 0)
+            dsp.add(row, row - 1);
+          if (i + 1 < n)
+            dsp.add(row, row + 1);
+          if (j > 0)
+            dsp.add(row, row - n);
+          if (j + 1 < n)
+            dsp.add(row, row + n);
+          if (k > 0)
+            dsp.add(row, row - n * n);
+          if (k + 1 < n)
+            dsp.add(row, row + n * n);
+        }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double> A(sparsity);
+  for (unsigned int row = 0; row < dim; ++row)
+    for (auto entry = A.begin(row); entry != A.end(row); ++entry)
+      entry->value() = (entry->column() == row) ? 6. : -1.;
+
+  test<SparseILU<double>>("ILU", A, SparseILU<double>::AdditionalData());
+  test<SparseILU<double>>("ILU with fill-in",
+                          A,
+                          SparseILU<double>::AdditionalData(0, 2));
+  test<SparseMIC<double>>("MIC", A, SparseMIC<double>::AdditionalData());
+}
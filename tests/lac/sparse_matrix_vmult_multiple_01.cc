@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check SparseMatrix::vmult_multiple against separate calls to vmult, for
+// different numbers of vectors and for both Vector and
+// LinearAlgebra::distributed::Vector
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType, typename number>
+void
+test(const SparseMatrix<number> &A, const unsigned int n_vectors)
+{
+  std::vector<VectorType> src(n_vectors), dst(n_vectors);
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      src[v].reinit(A.n());
+      dst[v].reinit(A.m());
+      for (unsigned int i = 0; i < A.n(); ++i)
+        src[v](i) = random_value<typename VectorType::value_type>();
+    }
+
+  A.vmult_multiple(dst, src);
+
+  double max_error = 0.;
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      VectorType ref(A.m());
+      A.vmult(ref, src[v]);
+      ref -= dst[v];
+      max_error = std::max<double>(max_error, ref.linfty_norm());
+    }
+  deallog << "n_vectors=" << n_vectors << " error: "
+          << (max_error < 1e-5 ? "ok" : "wrong") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern sparsity(dim, dim, 9);
+  testproblem.nine_point_structure(sparsity);
+  sparsity.compress();
+  SparseMatrix<double> A(sparsity);
+  testproblem.nine_point(A);
+  SparseMatrix<float> A_float(sparsity);
+  A_float.copy_from(A);
+
+  for (const unsigned int n_vectors : {1U, 3U, 8U, 11U})
+    {
+      test<Vector<double>>(A, n_vectors);
+      test<LinearAlgebra::distributed::Vector<double>>(A, n_vectors);
+      test<Vector<float>>(A_float, n_vectors);
+      test<Vector<double>>(A_float, n_vectors);
+    }
+}
@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check that a Laplace-plus-mass operator on a curved mesh gives the same
+// result when the Jacobians on the cells are computed on the fly from the
+// support points of the mapping as with the precomputed Jacobians, that the
+// support points are actually stored, and that this reduces the memory
+// consumption of MappingInfo
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+cell_operation(
+  const MatrixFree<dim, double>                    &matrix_free,
+  LinearAlgebra::distributed::Vector<double>       &dst,
+  const LinearAlgebra::distributed::Vector<double> &src,
+  const std::pair<unsigned int, unsigned int>      &cell_range)
+{
+  FEEvaluation<dim, fe_degree> phi(matrix_free);
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.gather_evaluate(src,
+                          EvaluationFlags::values | EvaluationFlags::gradients);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          phi.submit_value(phi.get_value(q), q);
+          phi.submit_gradient(phi.get_gradient(q), q);
+        }
+      phi.integrate_scatter(EvaluationFlags::values |
+                              EvaluationFlags::gradients,
+                            dst);
+    }
+}
+
+
+
+template <int dim, int fe_degree>
+LinearAlgebra::distributed::Vector<double>
+apply_operator(const Mapping<dim>                                &mapping,
+               const DoFHandler<dim>                             &dof_handler,
+               const LinearAlgebra::distributed::Vector<double> &src,
+               const bool   cell_geometry_on_the_fly,
+               std::size_t &mapping_memory)
+{
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+  data.cell_geometry_on_the_fly = cell_geometry_on_the_fly;
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  const auto &mapping_info = matrix_free.get_mapping_info();
+  mapping_memory           = mapping_info.memory_consumption();
+  if (cell_geometry_on_the_fly)
+    deallog << "dim=" << dim << " cell support points stored: "
+            << (mapping_info.cell_geometry_on_the_fly &&
+                    !mapping_info.cell_support_points.empty() ?
+                  "yes" :
+                  "no")
+            << std::endl;
+
+  LinearAlgebra::distributed::Vector<double> dst;
+  matrix_free.initialize_dof_vector(dst);
+
+  matrix_free.cell_loop(&cell_operation<dim, fe_degree>, dst, src);
+  return dst;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  constexpr int      fe_degree = 3;
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  tria.refine_global(4 - dim);
+
+  MappingQ<dim>   mapping(fe_degree);
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  // apply both variants of the operator to the same random vector
+  LinearAlgebra::distributed::Vector<double> src(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = random_value<double>();
+
+  std::size_t memory_stored = 0, memory_on_the_fly = 0;
+  const LinearAlgebra::distributed::Vector<double> reference =
+    apply_operator<dim, fe_degree>(
+      mapping, dof_handler, src, false, memory_stored);
+  LinearAlgebra::distributed::Vector<double> result =
+    apply_operator<dim, fe_degree>(
+      mapping, dof_handler, src, true, memory_on_the_fly);
+
+  deallog << "dim=" << dim << " memory of MappingInfo reduced: "
+          << (memory_on_the_fly < memory_stored ? "yes" : "no") << std::endl;
+
+  result -= reference;
+  const double error = result.linfty_norm() / reference.linfty_norm();
+  deallog << "dim=" << dim << " relative difference on the fly vs stored: "
+          << (error < 1e-12 ? 0. : error) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
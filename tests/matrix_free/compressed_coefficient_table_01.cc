@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check CompressedCoefficientTable for coefficients that are constant,
+// multilinear, and quadratic on the cells of a Cartesian mesh, and for a
+// coefficient that cannot be compressed: the detected degrees must be the
+// expected ones and the values at the quadrature points must be reproduced
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <deal.II/matrix_free/compressed_coefficient_table.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+class Coefficient : public Function<dim>
+{
+public:
+  Coefficient(const unsigned int type)
+    : type(type)
+  {}
+
+  double
+  value(const Point<dim> &p, const unsigned int = 0) const override
+  {
+    switch (type)
+      {
+        case 1:
+          return 1. + p[0] * p[dim - 1] + p[0];
+        case 2:
+          return 1. + p[0] * p[0] + p[dim - 1];
+        default:
+          return 2. + std::sin(3. * p[0]) * std::cos(2. * p[dim - 1]);
+      }
+  }
+
+private:
+  const unsigned int type;
+};
+
+
+
+template <int dim>
+void
+check(const MatrixFree<dim, double>                 &matrix_free,
+      const Table<2, VectorizedArray<double>>       &values,
+      const CompressedCoefficientTable<dim, double> &coefficient,
+      const std::string                             &name)
+{
+  unsigned int                           max_degree     = 0;
+  unsigned int                           n_uncompressed = 0;
+  double                                 max_error      = 0;
+  AlignedVector<VectorizedArray<double>> scratch;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      if (coefficient.get_degree(cell) == numbers::invalid_unsigned_int)
+        ++n_uncompressed;
+      else
+        max_degree = std::max(max_degree, coefficient.get_degree(cell));
+
+      const ArrayView<const VectorizedArray<double>> compressed =
+        coefficient.get_values(cell, scratch);
+      AssertDimension(compressed.size(), values.size(1));
+      for (unsigned int q = 0; q < compressed.size(); ++q)
+        for (unsigned int v = 0;
+             v < matrix_free.n_active_entries_per_cell_batch(cell);
+             ++v)
+          max_error = std::max(max_error,
+                               std::abs(compressed[q][v] - values(cell, q)[v]));
+    }
+
+  deallog << name << ": ";
+  if (n_uncompressed == matrix_free.n_cell_batches())
+    deallog << "no compression";
+  else
+    deallog << "max degree " << max_degree << ", uncompressed batches "
+            << n_uncompressed;
+  deallog << ", error " << (max_error < 1e-12 ? 0. : max_error)
+          << ", smaller than table: "
+          << (coefficient.memory_consumption() <
+              values.n_elements() * sizeof(VectorizedArray<double>))
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  FE_Q<dim>       fe(3);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags = update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(5), data);
+
+  FEEvaluation<dim, 3, 5> phi(matrix_free);
+  Table<2, VectorizedArray<double>> values(matrix_free.n_cell_batches(),
+                                           phi.n_q_points);
+
+  deallog << "dim=" << dim << std::endl;
+
+  // cell-wise constant coefficient given as a table
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    for (unsigned int v = 0;
+         v < matrix_free.n_active_entries_per_cell_batch(cell);
+         ++v)
+      {
+        const double value =
+          1. +
+          matrix_free.get_cell_iterator(cell, v)->active_cell_index() % 3;
+        for (unsigned int q = 0; q < phi.n_q_points; ++q)
+          values(cell, q)[v] = value;
+      }
+  {
+    CompressedCoefficientTable<dim, double> coefficient;
+    coefficient.initialize(matrix_free, values);
+    check(matrix_free, values, coefficient, "constant");
+  }
+
+  // coefficients given as functions
+  const std::string names[] = {"", "multilinear", "quadratic", "smooth"};
+  for (unsigned int type = 1; type < 4; ++type)
+    {
+      const Coefficient<dim> function(type);
+      for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+        {
+          phi.reinit(cell);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            for (unsigned int v = 0;
+                 v < matrix_free.n_active_entries_per_cell_batch(cell);
+                 ++v)
+              {
+                Point<dim> point;
+                for (unsigned int d = 0; d < dim; ++d)
+                  point[d] = phi.quadrature_point(q)[d][v];
+                values(cell, q)[v] = function.value(point);
+              }
+        }
+
+      CompressedCoefficientTable<dim, double> coefficient;
+      coefficient.initialize(matrix_free, function);
+      check(matrix_free, values, coefficient, names[type]);
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
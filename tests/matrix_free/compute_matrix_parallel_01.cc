@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check that MatrixFreeTools::compute_matrix() gives the same SparseMatrix
+// when the element matrices are scattered concurrently on colored cell
+// batches (several threads, MatrixFree without multithreading) as in the
+// serial case, for a mesh with hanging nodes and Dirichlet constraints, and
+// that the matrix agrees with the matrix-free operator
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test()
+{
+  using VectorizedArrayType = VectorizedArray<double>;
+  constexpr int n_q_points  = fe_degree + 1;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(4 - dim);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center().norm() < 0.4)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double, VectorizedArrayType>::AdditionalData data;
+  data.tasks_parallel_scheme =
+    MatrixFree<dim, double, VectorizedArrayType>::AdditionalData::none;
+  data.mapping_update_flags = update_values | update_gradients;
+
+  MatrixFree<dim, double, VectorizedArrayType> matrix_free;
+  matrix_free.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(n_q_points), data);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+
+  const auto cell_operation = [](auto &phi) {
+    phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+    for (const unsigned int q : phi.quadrature_point_indices())
+      {
+        phi.submit_value(phi.get_value(q), q);
+        phi.submit_gradient(phi.get_gradient(q), q);
+      }
+    phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+  };
+
+  SparseMatrix<double> matrix_serial(sparsity_pattern);
+  SparseMatrix<double> matrix_parallel(sparsity_pattern);
+
+  MultithreadInfo::set_thread_limit(1);
+  MatrixFreeTools::
+    compute_matrix<dim, fe_degree, n_q_points, 1, double, VectorizedArrayType>(
+      matrix_free, constraints, matrix_serial, cell_operation);
+
+  MultithreadInfo::set_thread_limit(4);
+  MatrixFreeTools::
+    compute_matrix<dim, fe_degree, n_q_points, 1, double, VectorizedArrayType>(
+      matrix_free, constraints, matrix_parallel, cell_operation);
+
+  matrix_parallel.add(-1., matrix_serial);
+  const double error_parallel =
+    matrix_parallel.frobenius_norm() / matrix_serial.frobenius_norm();
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " relative difference parallel vs serial: "
+          << (error_parallel < 1e-14 ? 0. : error_parallel) << std::endl;
+
+  // compare to the matrix-free operator on a vector with zero constrained
+  // entries
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs()),
+    dst_matrix(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    if (!constraints.is_constrained(i))
+      src(i) = random_value<double>();
+
+  matrix_free.template cell_loop<Vector<double>, Vector<double>>(
+    [&](const auto &data, auto &dst, const auto &src, const auto &range) {
+      FEEvaluation<dim, fe_degree, n_q_points, 1, double> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          cell_operation(phi);
+          phi.distribute_local_to_global(dst);
+        }
+    },
+    dst,
+    src);
+  for (unsigned int i = 0; i < src.size(); ++i)
+    if (constraints.is_constrained(i))
+      dst(i) = 0.;
+
+  matrix_serial.vmult(dst_matrix, src);
+  for (unsigned int i = 0; i < src.size(); ++i)
+    if (constraints.is_constrained(i))
+      dst_matrix(i) = 0.;
+
+  dst_matrix -= dst;
+  const double error_matrix_free = dst_matrix.l2_norm() / dst.l2_norm();
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " relative difference matrix vs matrix-free: "
+          << (error_matrix_free < 1e-12 ? 0. : error_matrix_free) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>();
+  test<2, 3>();
+  test<3, 2>();
+}
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check the access to vectors through the 16-bit compressed indices of
+// DoFInfo for cell batches with interleaved storage: reading the values on
+// all cells and adding them back must multiply each entry by the number of
+// cells sharing the unknown, and setting the values must reproduce the
+// vector
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int n_components>
+void
+test(const unsigned int fe_degree)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  FESystem<dim>   fe(FE_Q<dim>(fe_degree), n_components);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe_degree + 1),
+                     data);
+
+  const internal::MatrixFreeFunctions::DoFInfo &dof_info =
+    matrix_free.get_dof_info();
+  unsigned int n_interleaved = 0, n_compressed = 0;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    if (dof_info.index_storage_variants[2][cell] ==
+        internal::MatrixFreeFunctions::DoFInfo::IndexStorageVariants::
+          interleaved)
+      {
+        ++n_interleaved;
+        if (dof_info.dof_indices_interleaved_compressed_start[cell] !=
+            numbers::invalid_unsigned_int)
+          ++n_compressed;
+      }
+
+  VectorType src, dst, reference;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  matrix_free.initialize_dof_vector(reference);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = random_value<double>();
+
+  std::vector<types::global_dof_index> dof_indices(fe.dofs_per_cell);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(dof_indices);
+      for (const types::global_dof_index i : dof_indices)
+        reference(i) += src(i);
+    }
+
+  matrix_free.template cell_loop<VectorType, VectorType>(
+    [](const MatrixFree<dim, double>               &matrix_free,
+       VectorType                                  &dst,
+       const VectorType                            &src,
+       const std::pair<unsigned int, unsigned int> &cell_range) {
+      FEEvaluation<dim, -1, 0, n_components> phi(matrix_free);
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          phi.distribute_local_to_global(dst);
+        }
+    },
+    dst,
+    src,
+    true);
+  dst -= reference;
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " components=" << n_components << std::endl;
+  deallog << "interleaved batches present: " << (n_interleaved > 0)
+          << std::endl;
+  deallog << "all interleaved batches compressed: "
+          << (n_compressed == n_interleaved) << std::endl;
+  deallog << "compressed storage sized for compressed batches: "
+          << (dof_info.dof_indices_interleaved_compressed.size() ==
+              n_compressed * fe.dofs_per_cell *
+                VectorizedArray<double>::size())
+          << std::endl;
+  deallog << "Error read/distribute: " << dst.linfty_norm() << std::endl;
+
+  dst = 0;
+  FEEvaluation<dim, -1, 0, n_components> phi(matrix_free);
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      phi.set_dof_values(dst);
+    }
+  dst -= src;
+  deallog << "Error read/set: " << dst.linfty_norm() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>(1);
+  test<2, 1>(3);
+  test<2, 2>(2);
+  test<3, 1>(2);
+  test<3, 3>(1);
+}
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check that MatrixFreeTools::FusedCellOperators applying a mass, a Laplace,
+// and a convection operator in one sweep gives the same results as three
+// separate cell loops, both on a Cartesian and on a curved mesh with
+// hanging-node constraints
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test(const bool curved)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+  using FEEval     = FEEvaluation<dim, fe_degree>;
+
+  Triangulation<dim> tria;
+  if (curved)
+    GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  else
+    GridGenerator::hyper_cube(tria);
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  tria.refine_global(4 - dim);
+
+  MappingQ<dim>   mapping(fe_degree);
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), data);
+
+  Tensor<1, dim, VectorizedArray<double>> velocity;
+  for (unsigned int d = 0; d < dim; ++d)
+    velocity[d] = 1. + d;
+
+  const auto mass = [](FEEval &phi) {
+    for (const unsigned int q : phi.quadrature_point_indices())
+      phi.submit_value(phi.get_value(q), q);
+  };
+  const auto laplace = [](FEEval &phi) {
+    for (const unsigned int q : phi.quadrature_point_indices())
+      phi.submit_gradient(phi.get_gradient(q), q);
+  };
+  const auto convection = [&velocity](FEEval &phi) {
+    for (const unsigned int q : phi.quadrature_point_indices())
+      phi.submit_value(velocity * phi.get_gradient(q), q);
+  };
+
+  MatrixFreeTools::FusedCellOperators<dim, fe_degree> fused_operators;
+  fused_operators.reinit(matrix_free);
+  fused_operators.add_operator(EvaluationFlags::values,
+                               EvaluationFlags::values,
+                               mass);
+  fused_operators.add_operator(EvaluationFlags::gradients,
+                               EvaluationFlags::gradients,
+                               laplace);
+  fused_operators.add_operator(EvaluationFlags::gradients,
+                               EvaluationFlags::values,
+                               convection);
+
+  VectorType src;
+  matrix_free.initialize_dof_vector(src);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    if (!constraints.is_constrained(i))
+      src.local_element(i) = random_value<double>();
+
+  // reference results with one loop per operator
+  std::vector<VectorType> reference(3, src);
+  const std::array<EvaluationFlags::EvaluationFlags, 3> evaluation_flags = {
+    {EvaluationFlags::values,
+     EvaluationFlags::gradients,
+     EvaluationFlags::gradients}};
+  const std::array<EvaluationFlags::EvaluationFlags, 3> integration_flags = {
+    {EvaluationFlags::values,
+     EvaluationFlags::gradients,
+     EvaluationFlags::values}};
+  const std::array<std::function<void(FEEval &)>, 3> operations = {
+    {mass, laplace, convection}};
+  for (unsigned int k = 0; k < 3; ++k)
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const auto &matrix_free,
+          auto       &dst,
+          const auto &src,
+          const auto &range) {
+        FEEval phi(matrix_free);
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            phi.gather_evaluate(src, evaluation_flags[k]);
+            operations[k](phi);
+            phi.integrate_scatter(integration_flags[k], dst);
+          }
+      },
+      reference[k],
+      src,
+      true);
+
+  // fused loop with pointers to the destination vectors
+  std::vector<VectorType>   result(3, src);
+  std::vector<VectorType *> result_pointers = {&result[0],
+                                               &result[1],
+                                               &result[2]};
+  fused_operators.cell_loop(result_pointers, src, true);
+
+  // fused loop with the destination vectors stored by value, adding into
+  // the previous result
+  std::vector<VectorType> result_twice(result);
+  fused_operators.cell_loop(result_twice, src);
+
+  const char *names[] = {"mass", "laplace", "convection"};
+  for (unsigned int k = 0; k < 3; ++k)
+    {
+      result[k] -= reference[k];
+      result_twice[k].add(-2., reference[k]);
+      const double error =
+        std::max(result[k].linfty_norm(), 0.5 * result_twice[k].linfty_norm()) /
+        reference[k].linfty_norm();
+      deallog << "dim=" << dim << (curved ? " curved " : " cartesian ")
+              << names[k] << " relative difference fused vs separate: "
+              << (error < 1e-12 ? 0. : error) << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 2>(false);
+  test<2, 2>(true);
+  test<3, 2>(false);
+  test<3, 2>(true);
+}
@@ -0,0 +1,186 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check MatrixFree::AdditionalData::order_cells_along_hilbert_curve on a mesh
+// whose coarse cells are numbered in a scrambled order: the result of a mass
+// operator must not change, consecutive cell batches must share more
+// unknowns than with the default order, and the combination with
+// DoFRenumbering::matrix_free_data_locality() must give the same operator
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <set>
+
+#include "../tests.h"
+
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+template <int dim>
+void
+create_scrambled_mesh(Triangulation<dim> &tria)
+{
+  Triangulation<dim> structured;
+  GridGenerator::subdivided_hyper_cube(structured, 8);
+
+  std::vector<CellData<dim>> cells(structured.n_active_cells());
+  // 37 is coprime with the number of cells 8^dim, so this is a permutation
+  for (const auto &cell : structured.active_cell_iterators())
+    {
+      const unsigned int new_index =
+        (cell->active_cell_index() * 37) % cells.size();
+      for (const unsigned int v : cell->vertex_indices())
+        cells[new_index].vertices.push_back(cell->vertex_index(v));
+    }
+  tria.create_triangulation(structured.get_vertices(), cells, SubCellData());
+  tria.refine_global(1);
+}
+
+
+
+template <int dim>
+void
+mass_operator(const MatrixFree<dim, double>               &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &cell_range)
+{
+  FEEvaluation<dim, 2> phi(matrix_free);
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.gather_evaluate(src, EvaluationFlags::values);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        phi.submit_value(phi.get_value(q), q);
+      phi.integrate_scatter(EvaluationFlags::values, dst);
+    }
+}
+
+
+
+// count the unknowns that appear in two consecutive cell batches
+template <int dim>
+unsigned int
+count_shared_unknowns(const MatrixFree<dim, double> &matrix_free)
+{
+  std::vector<types::global_dof_index> dof_indices(
+    matrix_free.get_dof_handler().get_fe().dofs_per_cell);
+  std::set<types::global_dof_index> previous, current;
+  unsigned int                      count = 0;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      current.clear();
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        {
+          matrix_free.get_cell_iterator(cell, v)->get_dof_indices(dof_indices);
+          current.insert(dof_indices.begin(), dof_indices.end());
+        }
+      for (const types::global_dof_index i : current)
+        if (previous.find(i) != previous.end())
+          ++count;
+      previous.swap(current);
+    }
+  return count;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  create_scrambled_mesh(tria);
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+
+  MatrixFree<dim, double> matrix_free_default;
+  matrix_free_default.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(3), data);
+
+  data.order_cells_along_hilbert_curve = true;
+  MatrixFree<dim, double> matrix_free_hilbert;
+  matrix_free_hilbert.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(3), data);
+
+  VectorType src, dst_default, dst_hilbert;
+  matrix_free_default.initialize_dof_vector(src);
+  matrix_free_default.initialize_dof_vector(dst_default);
+  matrix_free_default.initialize_dof_vector(dst_hilbert);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = random_value<double>();
+
+  matrix_free_default.cell_loop(&mass_operator<dim>, dst_default, src, true);
+  matrix_free_hilbert.cell_loop(&mass_operator<dim>, dst_hilbert, src, true);
+  dst_hilbert -= dst_default;
+  deallog << "dim=" << dim << " difference default vs Hilbert order: "
+          << (dst_hilbert.linfty_norm() < 1e-14 ? 0. :
+                                                  dst_hilbert.linfty_norm())
+          << std::endl;
+  deallog << "More unknowns shared between consecutive batches: "
+          << (count_shared_unknowns(matrix_free_hilbert) >
+              count_shared_unknowns(matrix_free_default))
+          << std::endl;
+
+  // renumber the unknowns in the order of the cell loop and check the
+  // operator through the integral of the constant function one
+  DoFRenumbering::matrix_free_data_locality(dof_handler, constraints, data);
+  matrix_free_hilbert.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(3), data);
+  matrix_free_hilbert.initialize_dof_vector(src);
+  matrix_free_hilbert.initialize_dof_vector(dst_hilbert);
+  src = 1.;
+  matrix_free_hilbert.cell_loop(&mass_operator<dim>, dst_hilbert, src, true);
+  deallog << "Volume after renumbering: " << dst_hilbert.mean_value() *
+                                               dst_hilbert.size()
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
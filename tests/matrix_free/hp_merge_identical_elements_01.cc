@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check MatrixFree::AdditionalData::hp_merge_identical_elements for an
+// hp::FECollection that contains each element twice: the FE indices with
+// identical elements must be placed into a common category, the SIMD lane
+// utilization must not decrease, and the result of an operator evaluated
+// by looping over the FE indices must be the same as without merging
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <set>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+apply_operator(const MatrixFree<dim, double> &matrix_free,
+               Vector<double>                &dst,
+               const Vector<double>          &src)
+{
+  const unsigned int n_fe_indices =
+    matrix_free.get_dof_handler().get_fe_collection().size();
+  matrix_free.template cell_loop<Vector<double>, Vector<double>>(
+    [n_fe_indices](const auto &data,
+                   auto       &dst,
+                   const auto &src,
+                   const auto &range) {
+      for (unsigned int i = 0; i < n_fe_indices; ++i)
+        {
+          const auto subrange = data.create_cell_subrange_hp_by_index(range, i);
+          if (subrange.second == subrange.first)
+            continue;
+          FEEvaluation<dim, -1> phi(data, subrange);
+          for (unsigned int cell = subrange.first; cell < subrange.second;
+               ++cell)
+            {
+              phi.reinit(cell);
+              phi.gather_evaluate(src,
+                                  EvaluationFlags::values |
+                                    EvaluationFlags::gradients);
+              for (const unsigned int q : phi.quadrature_point_indices())
+                {
+                  phi.submit_value(phi.get_value(q), q);
+                  phi.submit_gradient(phi.get_gradient(q), q);
+                }
+              phi.integrate_scatter(EvaluationFlags::values |
+                                      EvaluationFlags::gradients,
+                                    dst);
+            }
+        }
+    },
+    dst,
+    src,
+    true);
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  hp::FECollection<dim> fe_collection;
+  hp::QCollection<1>    quadrature_collection;
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      const unsigned int degree = 1 + i % 2;
+      fe_collection.push_back(FE_DGQ<dim>(degree));
+      quadrature_collection.push_back(QGauss<1>(degree + 1));
+    }
+
+  DoFHandler<dim> dof(tria);
+  for (const auto &cell : dof.active_cell_iterators())
+    cell->set_active_fe_index(cell->active_cell_index() % 4);
+  dof.distribute_dofs(fe_collection);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  Vector<double> src(dof.n_dofs());
+  for (double &entry : src)
+    entry = random_value<double>();
+  Vector<double> dst_separate(dof.n_dofs()), dst_merged(dof.n_dofs());
+
+  double utilization_separate = 0.;
+  for (const bool merge : {false, true})
+    {
+      typename MatrixFree<dim, double>::AdditionalData data;
+      data.tasks_parallel_scheme =
+        MatrixFree<dim, double>::AdditionalData::none;
+      data.hp_merge_identical_elements = merge;
+
+      MatrixFree<dim, double> matrix_free;
+      matrix_free.reinit(
+        MappingQ1<dim>(), dof, constraints, quadrature_collection, data);
+
+      std::set<unsigned int> categories;
+      for (unsigned int c = 0; c < matrix_free.n_cell_batches(); ++c)
+        categories.insert(matrix_free.get_cell_active_fe_index({c, c + 1}));
+      deallog << "merge " << merge << ", categories:";
+      for (const unsigned int c : categories)
+        deallog << ' ' << c;
+      deallog << std::endl;
+
+      const double utilization = matrix_free.get_cell_lane_utilization();
+      deallog << "utilization in (0,1]: "
+              << (utilization > 0. && utilization <= 1.) << std::endl;
+
+      apply_operator(matrix_free, merge ? dst_merged : dst_separate, src);
+
+      if (merge)
+        deallog << "utilization not decreased: "
+                << (utilization >= utilization_separate) << std::endl;
+      else
+        utilization_separate = utilization;
+    }
+
+  dst_merged -= dst_separate;
+  deallog << "relative difference merged vs separate: "
+          << dst_merged.l2_norm() / dst_separate.l2_norm() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(5);
+
+  test<2>();
+  test<3>();
+}
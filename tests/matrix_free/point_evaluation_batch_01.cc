@@ -0,0 +1,147 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check FEPointBatchEvaluation, which vectorizes the point evaluation across
+// cells, against FEPointEvaluation on a curved mesh with a varying number of
+// points per cell, including cells without points, for a scalar element and
+// for a vector-valued FESystem
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_point_batch_evaluation.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
+#include "../tests.h"
+
+
+
+template <typename T>
+double
+difference_norm(const T &a, const T &b)
+{
+  if constexpr (std::is_same_v<T, double>)
+    return std::abs(a - b);
+  else
+    return (a - b).norm();
+}
+
+
+
+template <int n_components, int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., dim == 2 ? 6 : 12);
+  tria.refine_global(1);
+
+  MappingQ<dim>   mapping(3);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> vector(dof_handler.n_dofs());
+  for (double &entry : vector)
+    entry = random_value<double>();
+
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  std::vector<std::vector<Point<dim>>>                         unit_points;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      cells.push_back(cell);
+      unit_points.emplace_back(cell->active_cell_index() % 5);
+      for (Point<dim> &p : unit_points.back())
+        for (unsigned int d = 0; d < dim; ++d)
+          p[d] = random_value<double>();
+    }
+
+  NonMatching::MappingInfo<dim> mapping_info(mapping,
+                                             update_values | update_gradients);
+  mapping_info.reinit_cells(cells, unit_points);
+
+  std::vector<unsigned int> cell_indices;
+  std::vector<double>       solution_values;
+  std::vector<double>       cell_values(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell_indices.push_back(cell->active_cell_index());
+      cell->get_dof_values(vector, cell_values.begin(), cell_values.end());
+      solution_values.insert(solution_values.end(),
+                             cell_values.begin(),
+                             cell_values.end());
+    }
+
+  FEPointBatchEvaluation<n_components, dim> batch(mapping_info, fe);
+  batch.reinit(cell_indices);
+  batch.evaluate(solution_values,
+                 EvaluationFlags::values | EvaluationFlags::gradients);
+
+  FEPointEvaluation<n_components, dim> evaluator(mapping_info, fe);
+
+  unsigned int n_points        = 0;
+  double       error_values    = 0.;
+  double       error_gradients = 0.;
+  for (unsigned int c = 0; c < cell_indices.size(); ++c)
+    {
+      evaluator.reinit(cell_indices[c]);
+      evaluator.evaluate(
+        ArrayView<const double>(solution_values.data() +
+                                  c * fe.n_dofs_per_cell(),
+                                fe.n_dofs_per_cell()),
+        EvaluationFlags::values | EvaluationFlags::gradients);
+
+      AssertDimension(batch.n_points(c), unit_points[c].size());
+      for (unsigned int q = 0; q < batch.n_points(c); ++q)
+        {
+          error_values = std::max(
+            error_values,
+            difference_norm(evaluator.get_value(q), batch.get_value(c, q)));
+          error_gradients =
+            std::max(error_gradients,
+                     difference_norm(evaluator.get_gradient(q),
+                                     batch.get_gradient(c, q)));
+          ++n_points;
+        }
+    }
+
+  deallog << fe.get_name() << ": " << cell_indices.size() << " cells, "
+          << n_points << " points" << std::endl;
+  deallog << "values agree with FEPointEvaluation: " << (error_values < 1e-12)
+          << std::endl;
+  deallog << "gradients agree with FEPointEvaluation: "
+          << (error_gradients < 1e-10) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1, 2>(FE_Q<2>(3));
+  test<2, 2>(FESystem<2>(FE_Q<2>(2), 2));
+  test<1, 3>(FE_Q<3>(2));
+  test<3, 3>(FESystem<3>(FE_Q<3>(1), 3));
+}
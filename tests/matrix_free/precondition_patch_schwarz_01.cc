@@ -0,0 +1,172 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check PreconditionPatchSchwarz: on a single Cartesian cell, the cell
+// matrix is the exact Laplace matrix, so the preconditioner applied to the
+// operator gives the identity. on a mesh with hanging nodes, check that the
+// preconditioner is symmetric and that Chebyshev iterations around it are a
+// better preconditioner for CG than Chebyshev iterations around point-Jacobi
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/precondition_patch_schwarz.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree>
+void
+test(const unsigned int n_refinements)
+{
+  using VectorType   = LinearAlgebra::distributed::Vector<double>;
+  using OperatorType = MatrixFreeOperators::
+    LaplaceOperator<dim, fe_degree, fe_degree + 1, 1, VectorType>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  if (n_refinements > 0)
+    {
+      tria.refine_global(n_refinements);
+      tria.begin_active()->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ZeroFunction<dim>(),
+                                           constraints);
+  constraints.close();
+
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1),
+                      typename MatrixFree<dim, double>::AdditionalData());
+
+  OperatorType laplace;
+  laplace.initialize(matrix_free);
+  laplace.compute_diagonal();
+
+  using PreconditionerType = PreconditionPatchSchwarz<dim, fe_degree>;
+  const auto patch_schwarz = std::make_shared<PreconditionerType>();
+  patch_schwarz->initialize(*matrix_free,
+                            typename PreconditionerType::AdditionalData({0}));
+
+  VectorType x, y, tmp;
+  matrix_free->initialize_dof_vector(x);
+  y.reinit(x);
+  tmp.reinit(x);
+  for (unsigned int i = 0; i < x.locally_owned_size(); ++i)
+    if (!constraints.is_constrained(i))
+      {
+        x.local_element(i) = random_value<double>();
+        y.local_element(i) = random_value<double>();
+      }
+
+  deallog << "dim=" << dim << " degree=" << fe_degree
+          << " cells=" << tria.n_active_cells() << std::endl;
+
+  if (n_refinements == 0)
+    {
+      laplace.vmult(tmp, x);
+      VectorType result(x);
+      patch_schwarz->vmult(result, tmp);
+      result -= x;
+      const double error = result.linfty_norm() / x.linfty_norm();
+      deallog << "Error of P^{-1} A x - x on a single cell: "
+              << (error < 1e-12 ? 0. : error) << std::endl;
+      return;
+    }
+
+  patch_schwarz->vmult(tmp, y);
+  const double x_P_y = x * tmp;
+  patch_schwarz->vmult(tmp, x);
+  const double y_P_x = y * tmp;
+  const double asymmetry =
+    std::abs(x_P_y - y_P_x) / std::max(std::abs(x_P_y), std::abs(y_P_x));
+  deallog << "Relative asymmetry: " << (asymmetry < 1e-12 ? 0. : asymmetry)
+          << std::endl;
+
+  VectorType rhs(x);
+  laplace.vmult(rhs, x);
+
+  const auto count_iterations = [&](const auto &preconditioner) {
+    SolverControl        control(1000, 1e-10 * rhs.l2_norm());
+    SolverCG<VectorType> solver(control);
+    VectorType           solution(x);
+    solution = 0.;
+    solver.solve(laplace, solution, rhs, preconditioner);
+    return control.last_step();
+  };
+
+  typename PreconditionChebyshev<OperatorType, VectorType>::AdditionalData
+    jacobi_data;
+  jacobi_data.preconditioner  = laplace.get_matrix_diagonal_inverse();
+  jacobi_data.degree          = 3;
+  jacobi_data.smoothing_range = 20.;
+  PreconditionChebyshev<OperatorType, VectorType> chebyshev_jacobi;
+  chebyshev_jacobi.initialize(laplace, jacobi_data);
+
+  typename PreconditionChebyshev<OperatorType, VectorType, PreconditionerType>::
+    AdditionalData patch_data;
+  patch_data.preconditioner  = patch_schwarz;
+  patch_data.degree          = 3;
+  patch_data.smoothing_range = 20.;
+  PreconditionChebyshev<OperatorType, VectorType, PreconditionerType>
+    chebyshev_patch;
+  chebyshev_patch.initialize(laplace, patch_data);
+
+  const unsigned int iterations_jacobi = count_iterations(chebyshev_jacobi);
+  const unsigned int iterations_patch  = count_iterations(chebyshev_patch);
+  deallog << "Patch smoother needs fewer CG iterations than point-Jacobi: "
+          << (iterations_patch < iterations_jacobi) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 4>(0);
+  test<3, 3>(0);
+  test<2, 4>(3);
+  test<3, 3>(2);
+}
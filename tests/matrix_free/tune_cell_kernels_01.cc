@@ -0,0 +1,188 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check MatrixFree::AdditionalData::tune_cell_kernels: after reinit(), the
+// shape info of elements that support both the direct and the collocation
+// variant must hold an explicit choice, and a Laplace operator must give the
+// same result as with the heuristic choice up to roundoff, both for
+// FEEvaluation with compile-time and with run-time degree. Also check that
+// the cell kernels follow an explicitly requested variant.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+// Return whether the cell kernels for the given shape info use the
+// transformation to the collocation space: only this variant computes the
+// values in the quadrature points as an intermediate result when only the
+// gradients are requested.
+template <int dim, int fe_degree, int n_q_points_1d>
+bool
+uses_collocation(
+  const internal::MatrixFreeFunctions::ShapeInfo<double> &shape_info)
+{
+  FEEvaluationData<dim, VectorizedArray<double>, false> eval(shape_info);
+  AlignedVector<VectorizedArray<double>> scratch_data;
+  eval.set_data_pointers(&scratch_data, 1);
+
+  AlignedVector<VectorizedArray<double>> dof_values(
+    shape_info.dofs_per_component_on_cell);
+  for (unsigned int i = 0; i < dof_values.size(); ++i)
+    dof_values[i] = 0.1 * i + 1.;
+  for (unsigned int q = 0; q < shape_info.n_q_points; ++q)
+    eval.begin_values()[q] = 0.;
+
+  internal::FEEvaluationImplSelector<dim, VectorizedArray<double>, false>::
+    template run<fe_degree, n_q_points_1d>(1,
+                                           EvaluationFlags::gradients,
+                                           dof_values.data(),
+                                           eval);
+
+  return eval.begin_values()[0][0] != 0.;
+}
+
+
+
+template <int dim, int fe_degree, int n_q_points_1d>
+void
+apply_laplace(const MatrixFree<dim, double> &matrix_free,
+              Vector<double>                &dst,
+              const Vector<double>          &src)
+{
+  matrix_free.template cell_loop<Vector<double>, Vector<double>>(
+    [](const auto &data, auto &dst, const auto &src, const auto &range) {
+      FEEvaluation<dim, fe_degree, n_q_points_1d> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate_scatter(EvaluationFlags::gradients, dst);
+        }
+    },
+    dst,
+    src,
+    true);
+}
+
+
+
+template <int dim, int fe_degree, int n_q_points_1d>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., 2 * dim);
+  tria.refine_global(4 - dim);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  Vector<double> src(dof.n_dofs());
+  for (double &entry : src)
+    entry = random_value<double>();
+
+  Vector<double> result[3];
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      typename MatrixFree<dim, double>::AdditionalData data;
+      data.tasks_parallel_scheme =
+        MatrixFree<dim, double>::AdditionalData::none;
+      data.tune_cell_kernels = (i == 1);
+
+      MatrixFree<dim, double> matrix_free;
+      matrix_free.reinit(MappingQ1<dim>(),
+                         dof,
+                         constraints,
+                         QGauss<1>(n_q_points_1d),
+                         data);
+
+      if (i == 1)
+        {
+          using CellKernelVariant =
+            internal::MatrixFreeFunctions::CellKernelVariant;
+          internal::MatrixFreeFunctions::ShapeInfo<double> shape_info =
+            matrix_free.get_shape_info();
+          const CellKernelVariant variant = shape_info.cell_kernel_variant;
+          deallog << "degree " << fe_degree << " n_q_points_1d "
+                  << n_q_points_1d << ", explicit variant selected: "
+                  << (variant != CellKernelVariant::heuristic) << std::endl;
+
+          const bool tuned_variant_used =
+            uses_collocation<dim, fe_degree, n_q_points_1d>(shape_info) ==
+            (variant == CellKernelVariant::collocation);
+          shape_info.cell_kernel_variant = CellKernelVariant::direct;
+          const bool direct_used =
+            !uses_collocation<dim, fe_degree, n_q_points_1d>(shape_info);
+          shape_info.cell_kernel_variant = CellKernelVariant::collocation;
+          const bool collocation_used =
+            uses_collocation<dim, fe_degree, n_q_points_1d>(shape_info);
+          deallog << "variant used (tuned, direct, collocation): "
+                  << tuned_variant_used << " " << direct_used << " "
+                  << collocation_used << std::endl;
+        }
+
+      result[i].reinit(dof.n_dofs());
+      apply_laplace<dim, fe_degree, n_q_points_1d>(matrix_free,
+                                                   result[i],
+                                                   src);
+      if (i == 1)
+        {
+          result[2].reinit(dof.n_dofs());
+          apply_laplace<dim, -1, 0>(matrix_free, result[2], src);
+        }
+    }
+
+  const double norm = result[0].l2_norm();
+  result[1] -= result[0];
+  result[2] -= result[0];
+  deallog << "difference to heuristic below 1e-12: "
+          << (result[1].l2_norm() < 1e-12 * norm) << " "
+          << (result[2].l2_norm() < 1e-12 * norm) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1, 2>();
+  test<2, 2, 3>();
+  test<2, 3, 5>();
+  test<2, 4, 8>();
+  test<3, 2, 3>();
+  test<3, 3, 4>();
+  test<3, 3, 6>();
+}
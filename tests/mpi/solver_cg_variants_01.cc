@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+// check the single-reduction variants of SolverCG, which sum the inner
+// products with a non-blocking reduction, in parallel for a one-dimensional
+// finite difference Laplacian
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "../tests.h"
+
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+class Laplace1D
+{
+public:
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    src.update_ghost_values();
+    const IndexSet &owned = dst.locally_owned_elements();
+    for (const auto i : owned)
+      {
+        double value = 2. * src(i);
+        if (i > 0)
+          value -= src(i - 1);
+        if (i + 1 < dst.size())
+          value -= src(i + 1);
+        dst(i) = value;
+      }
+    src.zero_out_ghost_values();
+  }
+};
+
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const unsigned int n_local = 50;
+  const unsigned int size    = numproc * n_local;
+
+  IndexSet owned(size);
+  owned.add_range(myid * n_local, (myid + 1) * n_local);
+  IndexSet relevant = owned;
+  if (myid > 0)
+    relevant.add_index(myid * n_local - 1);
+  if (myid + 1 < numproc)
+    relevant.add_index((myid + 1) * n_local);
+
+  VectorType f(owned, relevant, MPI_COMM_WORLD);
+  for (const auto i : owned)
+    f(i) = 1. + 0.1 * (i % 3);
+
+  Laplace1D            A;
+  PreconditionIdentity identity;
+
+  VectorType               u_ref(f);
+  SolverControl            control(1000, 1e-10 * f.l2_norm());
+  SolverCG<VectorType> solver_ref(control);
+  u_ref = 0.;
+  solver_ref.solve(A, u_ref, f, identity);
+  const unsigned int n_steps_ref = control.last_step();
+
+  using Variant = SolverCG<VectorType>::Variant;
+  for (const auto variant : {Variant::chronopoulos_gear, Variant::pipelined})
+    {
+      VectorType u(f);
+      u = 0.;
+      SolverCG<VectorType> solver(control,
+                                  SolverCG<VectorType>::AdditionalData(true,
+                                                                       variant));
+      check_solver_within_range(solver.solve(A, u, f, identity),
+                                control.last_step(),
+                                n_steps_ref - 1,
+                                n_steps_ref + 1);
+      u -= u_ref;
+      deallog << "Difference to standard CG: "
+              << (u.linfty_norm() < 1e-6 * u_ref.linfty_norm() ? "small" :
+                                                                   "large")
+              << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check Partitioner::locally_owned_interior_ranges(),
+// LinearAlgebra::distributed::Vector::update_ghost_values_overlapped(), and
+// SparseMatrix::vmult_overlapped() for a matrix holding the locally owned
+// rows of a symmetric 1d stencil that couples each index to its neighbors at
+// distance one and three
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+double
+stencil_entry(const int distance)
+{
+  return distance == 0 ? 4. : (std::abs(distance) == 1 ? -1. : -0.5);
+}
+
+
+
+void
+test()
+{
+  const unsigned int my_id   = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  const unsigned int local_size  = 20;
+  const unsigned int global_size = n_procs * local_size;
+  const unsigned int my_start    = my_id * local_size;
+
+  const std::vector<int> offsets = {-3, -1, 0, 1, 3};
+
+  IndexSet owned(global_size), relevant(global_size);
+  owned.add_range(my_start, my_start + local_size);
+  relevant = owned;
+  for (unsigned int i = my_start; i < my_start + local_size; ++i)
+    for (const int offset : offsets)
+      if (int(i) + offset >= 0 && int(i) + offset < int(global_size))
+        relevant.add_index(i + offset);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(owned,
+                                                  relevant,
+                                                  MPI_COMM_WORLD);
+
+  deallog << "Interior ranges:";
+  for (const auto &range : partitioner->locally_owned_interior_ranges())
+    deallog << " [" << range.first << ',' << range.second << ')';
+  deallog << std::endl << "Boundary ranges:";
+  for (const auto &range : partitioner->locally_owned_boundary_ranges())
+    deallog << " [" << range.first << ',' << range.second << ')';
+  deallog << std::endl;
+
+  // build the matrix of the locally owned rows in the local numbering of the
+  // vector
+  const unsigned int n_columns =
+    partitioner->locally_owned_size() + partitioner->n_ghost_indices();
+  DynamicSparsityPattern dsp(local_size, n_columns);
+  for (unsigned int i = 0; i < local_size; ++i)
+    for (const int offset : offsets)
+      {
+        const int j = my_start + i + offset;
+        if (j >= 0 && j < int(global_size))
+          dsp.add(i, partitioner->global_to_local(j));
+      }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> matrix(sparsity);
+  for (unsigned int i = 0; i < local_size; ++i)
+    for (const int offset : offsets)
+      {
+        const int j = my_start + i + offset;
+        if (j >= 0 && j < int(global_size))
+          matrix.set(i, partitioner->global_to_local(j), stencil_entry(offset));
+      }
+
+  LinearAlgebra::distributed::Vector<double> src(partitioner),
+    dst(partitioner);
+  for (unsigned int i = my_start; i < my_start + local_size; ++i)
+    src(i) = std::sin(0.1 * i);
+
+  // the interior rows do not need any ghost value
+  unsigned int n_interior = 0, n_boundary = 0;
+  src.update_ghost_values_overlapped(
+    [&](const unsigned int begin, const unsigned int end) {
+      n_interior += end - begin;
+    },
+    [&](const unsigned int begin, const unsigned int end) {
+      n_boundary += end - begin;
+    });
+  deallog << "Interior/boundary entries: " << n_interior << ' ' << n_boundary
+          << std::endl;
+  deallog << "Ghosted after exchange: " << src.has_ghost_elements()
+          << std::endl;
+  src.zero_out_ghost_values();
+
+  matrix.vmult_overlapped(dst, src);
+
+  double error = 0;
+  for (unsigned int i = my_start; i < my_start + local_size; ++i)
+    {
+      double reference = 0;
+      for (const int offset : offsets)
+        if (int(i) + offset >= 0 && int(i) + offset < int(global_size))
+          reference += stencil_entry(offset) * std::sin(0.1 * (i + offset));
+      error = std::max(error, std::abs(dst(i) - reference));
+    }
+  deallog << "Error vmult_overlapped: " << (error < 1e-14 ? "ok" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
@@ -0,0 +1,296 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+/**
+ * Test FullMultigrid: solve a Poisson problem with nested iteration on a
+ * global-coarsening hierarchy and compare the algebraic error with respect to
+ * the converged discrete solution on the finest level against the difference
+ * between the discrete solutions on the two finest levels, which is a
+ * measure of the discretization error. Also check that a separately given
+ * interpolation operator is used for the solution between the levels.
+ */
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+/**
+ * A level transfer forwarding to another transfer object that counts the
+ * calls of its functions.
+ */
+template <typename VectorType>
+class CountingTransfer : public MGTransferBase<VectorType>
+{
+public:
+  CountingTransfer(const MGTransferBase<VectorType> &transfer)
+    : transfer(transfer)
+  {}
+
+  void
+  prolongate(const unsigned int to_level,
+             VectorType        &dst,
+             const VectorType  &src) const override
+  {
+    ++n_prolongations;
+    transfer.prolongate(to_level, dst, src);
+  }
+
+  void
+  restrict_and_add(const unsigned int from_level,
+                   VectorType        &dst,
+                   const VectorType  &src) const override
+  {
+    ++n_restrictions;
+    transfer.restrict_and_add(from_level, dst, src);
+  }
+
+  mutable unsigned int n_prolongations = 0;
+  mutable unsigned int n_restrictions  = 0;
+
+private:
+  const MGTransferBase<VectorType> &transfer;
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  using VectorType      = LinearAlgebra::distributed::Vector<double>;
+  using LevelMatrixType = MatrixFreeOperators::LaplaceOperator<dim, 1>;
+  using SmootherType    = PreconditionChebyshev<LevelMatrixType, VectorType>;
+  using TransferType    = MGTransferMatrixFree<dim, double>;
+  using FMGType         = FullMultigrid<dim, VectorType, TransferType>;
+
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5);
+
+  const auto trias =
+    MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      tria);
+
+  const unsigned int min_level = 0;
+  const unsigned int max_level = trias.size() - 1;
+
+  const FE_Q<dim>      fe(1);
+  const MappingQ1<dim> mapping;
+
+  MGLevelObject<DoFHandler<dim>>           dof_handlers(min_level, max_level);
+  MGLevelObject<AffineConstraints<double>> constraints(min_level, max_level);
+  MGLevelObject<MGTwoLevelTransfer<dim, VectorType>> transfers(min_level,
+                                                               max_level);
+  MGLevelObject<LevelMatrixType> operators(min_level, max_level);
+
+  for (unsigned int l = min_level; l <= max_level; ++l)
+    {
+      dof_handlers[l].reinit(*trias[l]);
+      dof_handlers[l].distribute_dofs(fe);
+
+      constraints[l].reinit(
+        dof_handlers[l].locally_owned_dofs(),
+        DoFTools::extract_locally_relevant_dofs(dof_handlers[l]));
+      VectorTools::interpolate_boundary_values(mapping,
+                                               dof_handlers[l],
+                                               0,
+                                               Functions::ZeroFunction<dim>(),
+                                               constraints[l]);
+      constraints[l].close();
+
+      const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+      matrix_free->reinit(mapping,
+                          dof_handlers[l],
+                          constraints[l],
+                          QGauss<1>(2),
+                          typename MatrixFree<dim, double>::AdditionalData());
+      operators[l].initialize(matrix_free);
+      operators[l].compute_diagonal();
+    }
+
+  for (unsigned int l = min_level; l < max_level; ++l)
+    transfers[l + 1].reinit(dof_handlers[l + 1],
+                            dof_handlers[l],
+                            constraints[l + 1],
+                            constraints[l]);
+
+  TransferType transfer(transfers, [&](const unsigned int l, VectorType &vec) {
+    operators[l].initialize_dof_vector(vec);
+  });
+
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    min_level, max_level);
+  for (unsigned int l = min_level; l <= max_level; ++l)
+    {
+      if (l > min_level)
+        {
+          smoother_data[l].smoothing_range     = 15.;
+          smoother_data[l].degree              = 4;
+          smoother_data[l].eig_cg_n_iterations = 10;
+        }
+      else
+        {
+          smoother_data[l].smoothing_range     = 1e-3;
+          smoother_data[l].degree              = numbers::invalid_unsigned_int;
+          smoother_data[l].eig_cg_n_iterations = operators[l].m();
+        }
+      smoother_data[l].preconditioner =
+        operators[l].get_matrix_diagonal_inverse();
+    }
+
+  mg::SmootherRelaxation<SmootherType, VectorType> mg_smoother;
+  mg_smoother.initialize(operators, smoother_data);
+
+  MGCoarseGridApplySmoother<VectorType> mg_coarse;
+  mg_coarse.initialize(mg_smoother);
+
+  mg::Matrix<VectorType> mg_matrix(operators);
+
+  Multigrid<VectorType> mg(
+    mg_matrix, mg_coarse, transfer, mg_smoother, mg_smoother);
+
+  PreconditionMG<dim, VectorType, TransferType> preconditioner(
+    dof_handlers[max_level], mg, transfer);
+
+  // converged discrete solutions on the two finest levels
+  VectorType src, reference;
+  operators[max_level].initialize_dof_vector(src);
+  operators[max_level].initialize_dof_vector(reference);
+  src = 1.;
+  constraints[max_level].set_zero(src);
+
+  ReductionControl     control(100, 1e-14, 1e-12, false, false);
+  SolverCG<VectorType> solver(control);
+  solver.solve(operators[max_level], reference, src, preconditioner);
+
+  VectorType src_coarse, reference_coarse;
+  operators[max_level - 1].initialize_dof_vector(src_coarse);
+  operators[max_level - 1].initialize_dof_vector(reference_coarse);
+  transfer.restrict_and_add(max_level, src_coarse, src);
+  constraints[max_level - 1].set_zero(src_coarse);
+
+  SolverControl        control_coarse(1000, 1e-12 * src_coarse.l2_norm());
+  SolverCG<VectorType> solver_coarse(control_coarse);
+  solver_coarse.solve(operators[max_level - 1],
+                      reference_coarse,
+                      src_coarse,
+                      PreconditionIdentity());
+
+  VectorType difference(reference);
+  transfer.prolongate(max_level, difference, reference_coarse);
+  difference -= reference;
+  constraints[max_level].set_zero(difference);
+  const double discretization_error = difference.l2_norm();
+
+  const auto compute_error = [&](const FMGType &fmg) {
+    VectorType dst(reference);
+    dst = 0.;
+    fmg.solve(dst, src);
+    constraints[max_level].distribute(dst);
+    dst -= reference;
+    constraints[max_level].set_zero(dst);
+    return dst.l2_norm();
+  };
+
+  const double error_fmg_1 =
+    compute_error(FMGType(dof_handlers[max_level],
+                          mg,
+                          transfer,
+                          typename FMGType::AdditionalData(
+                            FMGType::full_multigrid, 1)));
+  const double error_fmg_2 =
+    compute_error(FMGType(dof_handlers[max_level],
+                          mg,
+                          transfer,
+                          typename FMGType::AdditionalData(
+                            FMGType::full_multigrid, 2)));
+  const CountingTransfer<VectorType> interpolation(transfer);
+
+  const double error_interpolation = compute_error(
+    FMGType(dof_handlers[max_level], mg, transfer, interpolation));
+
+  deallog << "FMG with one V-cycle below discretization error: "
+          << (error_fmg_1 < discretization_error) << std::endl;
+  deallog << "FMG with two V-cycles more accurate: "
+          << (error_fmg_2 < error_fmg_1) << std::endl;
+  deallog << "FMG with separate interpolation agrees: "
+          << (std::abs(error_interpolation - error_fmg_1) <
+              1e-12 * discretization_error)
+          << std::endl;
+  deallog << "Separate interpolation used once per level: "
+          << (interpolation.n_prolongations == max_level - min_level)
+          << std::endl;
+  deallog << "Separate interpolation not used for restriction: "
+          << (interpolation.n_restrictions == 0) << std::endl;
+
+  mg.set_cycle(Multigrid<VectorType>::w_cycle);
+  const double error_fmg_w =
+    compute_error(FMGType(dof_handlers[max_level], mg, transfer));
+  deallog << "FMG with one W-cycle below discretization error: "
+          << (error_fmg_w < discretization_error) << std::endl;
+
+  const double error_cascadic_1 =
+    compute_error(FMGType(dof_handlers[max_level],
+                          mg,
+                          transfer,
+                          typename FMGType::AdditionalData(FMGType::cascadic,
+                                                           1)));
+  const double error_cascadic_4 =
+    compute_error(FMGType(dof_handlers[max_level],
+                          mg,
+                          transfer,
+                          typename FMGType::AdditionalData(FMGType::cascadic,
+                                                           4)));
+  deallog << "Cascadic with more smoothing steps more accurate: "
+          << (error_cascadic_4 < error_cascadic_1) << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  mpi_initlog();
+
+  test<2>();
+}
@@ -0,0 +1,215 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+/**
+ * Test MGTransferGlobalCoarseningTools::create_level_communicator(): solve a
+ * Poisson problem with global-coarsening multigrid on levels repartitioned
+ * with RepartitioningPolicyTools::MinimalGranularityPolicy, once with level
+ * operators on the full communicator and once with level operators on the
+ * communicators restricted to the processes with cells, and compare.
+ */
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::pair<unsigned int, LinearAlgebra::distributed::Vector<double>>
+solve(const Triangulation<dim> &tria, const bool use_level_communicators)
+{
+  using VectorType      = LinearAlgebra::distributed::Vector<double>;
+  using LevelMatrixType = MatrixFreeOperators::LaplaceOperator<dim, 1>;
+  using SmootherType    = PreconditionChebyshev<LevelMatrixType, VectorType>;
+
+  const auto trias =
+    MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      tria, RepartitioningPolicyTools::MinimalGranularityPolicy<dim>(8));
+
+  const unsigned int min_level = 0;
+  const unsigned int max_level = trias.size() - 1;
+
+  const FE_Q<dim>      fe(1);
+  const MappingQ1<dim> mapping;
+
+  MGLevelObject<DoFHandler<dim>>           dof_handlers(min_level, max_level);
+  MGLevelObject<AffineConstraints<double>> constraints(min_level, max_level);
+  MGLevelObject<MGTwoLevelTransfer<dim, VectorType>> transfers(min_level,
+                                                               max_level);
+  MGLevelObject<LevelMatrixType> operators(min_level, max_level);
+  std::vector<MPI_Comm>          level_communicators;
+
+  for (unsigned int l = min_level; l <= max_level; ++l)
+    {
+      dof_handlers[l].reinit(*trias[l]);
+      dof_handlers[l].distribute_dofs(fe);
+
+      constraints[l].reinit(
+        dof_handlers[l].locally_owned_dofs(),
+        DoFTools::extract_locally_relevant_dofs(dof_handlers[l]));
+      VectorTools::interpolate_boundary_values(mapping,
+                                               dof_handlers[l],
+                                               0,
+                                               Functions::ZeroFunction<dim>(),
+                                               constraints[l]);
+      constraints[l].close();
+
+      typename MatrixFree<dim, double>::AdditionalData additional_data;
+      if (use_level_communicators)
+        {
+          level_communicators.push_back(
+            MGTransferGlobalCoarseningTools::create_level_communicator(
+              *trias[l]));
+          additional_data.communicator = level_communicators.back();
+        }
+
+      const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+      matrix_free->reinit(mapping,
+                          dof_handlers[l],
+                          constraints[l],
+                          QGauss<1>(2),
+                          additional_data);
+      operators[l].initialize(matrix_free);
+      operators[l].compute_diagonal();
+
+      if (use_level_communicators)
+        deallog << "level " << l << ": "
+                << Utilities::MPI::n_mpi_processes(
+                     matrix_free->get_vector_partitioner()
+                       ->get_mpi_communicator())
+                << " processes" << std::endl;
+    }
+
+  for (unsigned int l = min_level; l < max_level; ++l)
+    transfers[l + 1].reinit(dof_handlers[l + 1],
+                            dof_handlers[l],
+                            constraints[l + 1],
+                            constraints[l]);
+
+  MGTransferMatrixFree<dim, double> transfer(
+    transfers, [&](const unsigned int l, VectorType &vec) {
+      operators[l].initialize_dof_vector(vec);
+    });
+
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    min_level, max_level);
+  for (unsigned int l = min_level; l <= max_level; ++l)
+    {
+      if (l > min_level)
+        {
+          smoother_data[l].smoothing_range     = 15.;
+          smoother_data[l].degree              = 4;
+          smoother_data[l].eig_cg_n_iterations = 10;
+        }
+      else
+        {
+          smoother_data[l].smoothing_range     = 1e-3;
+          smoother_data[l].degree              = numbers::invalid_unsigned_int;
+          smoother_data[l].eig_cg_n_iterations = operators[l].m();
+        }
+      smoother_data[l].preconditioner =
+        operators[l].get_matrix_diagonal_inverse();
+    }
+
+  mg::SmootherRelaxation<SmootherType, VectorType> mg_smoother;
+  mg_smoother.initialize(operators, smoother_data);
+
+  MGCoarseGridApplySmoother<VectorType> mg_coarse;
+  mg_coarse.initialize(mg_smoother);
+
+  mg::Matrix<VectorType> mg_matrix(operators);
+
+  Multigrid<VectorType> mg(
+    mg_matrix, mg_coarse, transfer, mg_smoother, mg_smoother);
+
+  PreconditionMG<dim, VectorType, MGTransferMatrixFree<dim, double>>
+    preconditioner(dof_handlers[max_level], mg, transfer);
+
+  VectorType src, dst;
+  operators[max_level].initialize_dof_vector(src);
+  operators[max_level].initialize_dof_vector(dst);
+  src = 1.;
+  constraints[max_level].set_zero(src);
+
+  ReductionControl     control(100, 1e-14, 1e-10, false, false);
+  SolverCG<VectorType> solver(control);
+  solver.solve(operators[max_level], dst, src, preconditioner);
+
+  for (const MPI_Comm comm : level_communicators)
+    Utilities::MPI::free_communicator(comm);
+
+  return {control.last_step(), dst};
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(4);
+
+  const auto [n_iterations_full, solution_full] = solve(tria, false);
+  const auto [n_iterations_level, solution_level] = solve(tria, true);
+
+  auto difference = solution_level;
+  difference.add(-1., solution_full);
+
+  deallog << "iteration numbers agree: "
+          << (n_iterations_full == n_iterations_level) << std::endl;
+  deallog << "solutions agree: "
+          << (difference.linfty_norm() < 1e-10 * solution_full.linfty_norm())
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  mpi_initlog();
+
+  test<2>();
+}
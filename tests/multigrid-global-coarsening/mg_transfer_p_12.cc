@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+/**
+ * Test transfer operator for polynomial coarsening of finite elements
+ * composed of several base elements, like the Taylor-Hood element. Check
+ * that prolongation and interpolation are exact for functions contained in
+ * the coarse space and that restriction is the transpose of prolongation.
+ */
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/logstream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "mg_transfer_util.h"
+
+using namespace dealii;
+
+template <int dim>
+class LinearFunction : public Function<dim>
+{
+public:
+  LinearFunction()
+    : Function<dim>(dim + 1)
+  {}
+
+  double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    double result = 1. + component;
+    for (unsigned int d = 0; d < dim; ++d)
+      result += (component + d + 1.) * p[d];
+    return result;
+  }
+};
+
+template <int dim, typename Number>
+void
+do_test(const FiniteElement<dim> &fe_fine, const FiniteElement<dim> &fe_coarse)
+{
+  Triangulation<dim> tria;
+
+  // create grid with hanging nodes
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global();
+
+  for (auto &cell : tria.active_cell_iterators())
+    if (cell->is_active() && cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  // setup dof-handlers
+  DoFHandler<dim> dof_handler_fine(tria);
+  dof_handler_fine.distribute_dofs(fe_fine);
+
+  DoFHandler<dim> dof_handler_coarse(tria);
+  dof_handler_coarse.distribute_dofs(fe_coarse);
+
+  AffineConstraints<Number> constraint_coarse;
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraint_coarse);
+  constraint_coarse.close();
+
+  AffineConstraints<Number> constraint_fine;
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraint_fine);
+  constraint_fine.close();
+
+  // setup transfer operator
+  MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>> transfer;
+  transfer.reinit(dof_handler_fine,
+                  dof_handler_coarse,
+                  constraint_fine,
+                  constraint_coarse);
+
+  LinearAlgebra::distributed::Vector<Number> vec_fine, vec_coarse;
+  initialize_dof_vector(vec_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(vec_coarse,
+                        dof_handler_coarse,
+                        numbers::invalid_unsigned_int);
+
+  LinearAlgebra::distributed::Vector<Number> ref_fine(vec_fine),
+    ref_coarse(vec_coarse);
+  VectorTools::interpolate(dof_handler_fine, LinearFunction<dim>(), ref_fine);
+  VectorTools::interpolate(dof_handler_coarse,
+                           LinearFunction<dim>(),
+                           ref_coarse);
+
+  // prolongation reproduces functions of the coarse space
+  {
+    vec_fine = 0.;
+    transfer.prolongate_and_add(vec_fine, ref_coarse);
+    constraint_fine.distribute(vec_fine);
+    vec_fine -= ref_fine;
+
+    deallog << "Prolongation exact: "
+            << (vec_fine.linfty_norm() < 1e-12 * ref_fine.linfty_norm())
+            << std::endl;
+  }
+
+  // interpolation reproduces functions of the coarse space
+  {
+    vec_coarse = 0.;
+    transfer.interpolate(vec_coarse, ref_fine);
+    vec_coarse -= ref_coarse;
+
+    deallog << "Interpolation exact: "
+            << (vec_coarse.linfty_norm() < 1e-12 * ref_coarse.linfty_norm())
+            << std::endl;
+  }
+
+  // restriction is the transpose of prolongation
+  {
+    LinearAlgebra::distributed::Vector<Number> src_fine(vec_fine),
+      src_coarse(vec_coarse);
+    for (unsigned int i = 0; i < src_fine.locally_owned_size(); ++i)
+      src_fine.local_element(i) = random_value<Number>();
+    for (unsigned int i = 0; i < src_coarse.locally_owned_size(); ++i)
+      src_coarse.local_element(i) = random_value<Number>();
+    constraint_fine.set_zero(src_fine);
+    constraint_coarse.set_zero(src_coarse);
+
+    vec_fine = 0.;
+    transfer.prolongate_and_add(vec_fine, src_coarse);
+    constraint_fine.set_zero(vec_fine);
+
+    vec_coarse = 0.;
+    transfer.restrict_and_add(vec_coarse, src_fine);
+    constraint_coarse.set_zero(vec_coarse);
+
+    const Number product_fine   = vec_fine * src_fine;
+    const Number product_coarse = vec_coarse * src_coarse;
+
+    deallog << "Restriction is transpose: "
+            << (std::abs(product_fine - product_coarse) <
+                1e-12 * std::abs(product_fine))
+            << std::endl;
+  }
+}
+
+template <int dim, typename Number>
+void
+test()
+{
+  {
+    deallog.push("Q2^d-Q1<->Q1^d-Q1");
+    do_test<dim, Number>(FESystem<dim>(FE_Q<dim>(2), dim, FE_Q<dim>(1), 1),
+                         FESystem<dim>(FE_Q<dim>(1), dim, FE_Q<dim>(1), 1));
+    deallog.pop();
+  }
+
+  {
+    deallog.push("Q3^d-Q2<->Q2^d-Q1");
+    do_test<dim, Number>(FESystem<dim>(FE_Q<dim>(3), dim, FE_Q<dim>(2), 1),
+                         FESystem<dim>(FE_Q<dim>(2), dim, FE_Q<dim>(1), 1));
+    deallog.pop();
+  }
+
+  {
+    deallog.push("DGQ2^d-DGQ1<->DGQ1^d-DGQ1");
+    do_test<dim, Number>(
+      FESystem<dim>(FE_DGQ<dim>(2), dim, FE_DGQ<dim>(1), 1),
+      FESystem<dim>(FE_DGQ<dim>(1), dim, FE_DGQ<dim>(1), 1));
+    deallog.pop();
+  }
+}
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2, double>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3, double>();
+  deallog.pop();
+}
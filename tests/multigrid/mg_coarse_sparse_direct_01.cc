@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+
+// check MGCoarseGridSparseDirect for a distributed tridiagonal matrix whose
+// rows are given by a SparseMatrix of global size that only contains the
+// locally owned rows, with different sizes of the groups of processes. The
+// matrix must be factorized on a single process in all cases.
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+
+#include "../tests.h"
+
+
+
+void
+test(const unsigned int max_group_size)
+{
+  const MPI_Comm                comm = MPI_COMM_WORLD;
+  const types::global_dof_index n    = 100;
+
+  const IndexSet locally_owned_rows =
+    Utilities::create_evenly_distributed_partitioning(
+      Utilities::MPI::this_mpi_process(comm),
+      Utilities::MPI::n_mpi_processes(comm),
+      n);
+
+  DynamicSparsityPattern dsp(n, n);
+  for (const types::global_dof_index i : locally_owned_rows)
+    for (types::global_dof_index j = (i > 0 ? i - 1 : 0);
+         j < std::min(i + 2, n);
+         ++j)
+      dsp.add(i, j);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+
+  SparseMatrix<double> matrix(sparsity_pattern);
+  for (const types::global_dof_index i : locally_owned_rows)
+    {
+      matrix.set(i, i, 2.5);
+      if (i > 0)
+        matrix.set(i, i - 1, -1.);
+      if (i + 1 < n)
+        matrix.set(i, i + 1, -1.);
+    }
+
+  // right hand side for the solution x_i = i
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+  VectorType src(locally_owned_rows, comm), dst(locally_owned_rows, comm);
+  for (const types::global_dof_index i : locally_owned_rows)
+    src(i) = 2.5 * i - (i > 0 ? i - 1. : 0.) - (i + 1 < n ? i + 1. : 0.);
+
+  MGCoarseGridSparseDirect<VectorType> coarse_solver;
+  coarse_solver.initialize(matrix,
+                           locally_owned_rows,
+                           comm,
+                           MGCoarseGridSparseDirect<VectorType>::AdditionalData(
+                             max_group_size));
+  coarse_solver(0, dst, src);
+
+  double error = 0.;
+  for (const types::global_dof_index i : locally_owned_rows)
+    error = std::max(error, std::abs(dst(i) - static_cast<double>(i)));
+  error = Utilities::MPI::max(error, comm);
+
+  deallog << "max_group_size " << max_group_size << ": "
+          << coarse_solver.n_factorizing_processes()
+          << " factorizing processes, error below 1e-10: " << (error < 1e-10)
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  mpi_initlog();
+
+  // the object owns MPI communicators and must not be copied
+  using CoarseSolverType =
+    MGCoarseGridSparseDirect<LinearAlgebra::distributed::Vector<double>>;
+  static_assert(!std::is_copy_constructible_v<CoarseSolverType>);
+  static_assert(!std::is_copy_assignable_v<CoarseSolverType>);
+
+  test(1);
+  test(2);
+  test(64);
+}
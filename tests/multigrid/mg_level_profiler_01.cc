@@ -0,0 +1,182 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+
+/*
+ * Test MGLevelProfiler: count the calls of the phases on each level for V-
+ * and W-cycles without any numerics, similar to the test cycles. The
+ * transfer operators are void and we use the same matrix on each level.
+ */
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_level_profiler.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+
+#define N 3
+using VectorType = Vector<double>;
+
+class MGAll : public MGSmootherBase<VectorType>,
+              public MGTransferBase<VectorType>,
+              public MGCoarseGridBase<VectorType>
+{
+public:
+  virtual ~MGAll()
+  {}
+
+  virtual void
+  smooth(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  prolongate(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  restrict_and_add(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  clear()
+  {}
+
+  virtual void
+  operator()(const unsigned int, VectorType &, const VectorType &) const
+  {}
+};
+
+class TransferToMGDummy : public EnableObserverPointer
+{
+public:
+  template <int dim>
+  void
+  copy_to_mg(const DoFHandler<dim> &,
+             MGLevelObject<VectorType> &,
+             const VectorType &) const
+  {}
+
+  template <int dim>
+  void
+  copy_from_mg(const DoFHandler<dim> &,
+               VectorType &,
+               const MGLevelObject<VectorType> &) const
+  {}
+};
+
+void
+print_calls(const MGLevelProfiler &profiler, const unsigned int maxlevel)
+{
+  const std::vector<std::pair<MGLevelProfiler::Phase, std::string>> phases = {
+    {MGLevelProfiler::Phase::pre_smoother_step, "pre"},
+    {MGLevelProfiler::Phase::residual_step, "residual"},
+    {MGLevelProfiler::Phase::restriction, "restriction"},
+    {MGLevelProfiler::Phase::coarse_solve, "coarse"},
+    {MGLevelProfiler::Phase::prolongation, "prolongation"},
+    {MGLevelProfiler::Phase::edge_prolongation, "edge"},
+    {MGLevelProfiler::Phase::post_smoother_step, "post"}};
+
+  for (unsigned int level = 0; level <= maxlevel; ++level)
+    {
+      deallog << "Level " << level << ":";
+      for (const auto &phase : phases)
+        deallog << ' ' << phase.second << '='
+                << profiler.get_n_calls(phase.first, level);
+      deallog << std::endl;
+    }
+  deallog << "Transfer: to_mg="
+          << profiler.get_n_calls(MGLevelProfiler::Phase::transfer_to_mg)
+          << " to_global="
+          << profiler.get_n_calls(MGLevelProfiler::Phase::transfer_to_global)
+          << std::endl;
+}
+
+void
+test_profiler(const unsigned int minlevel, const unsigned int maxlevel)
+{
+  MGAll                             all;
+  MGLevelObject<FullMatrix<double>> level_matrices(0, maxlevel);
+  for (unsigned int i = 0; i <= maxlevel; ++i)
+    level_matrices[i].reinit(N, N);
+  mg::Matrix<VectorType> mgmatrix(level_matrices);
+
+  Multigrid<VectorType> mg(mgmatrix,
+                           all,
+                           all,
+                           all,
+                           all,
+                           minlevel,
+                           maxlevel,
+                           Multigrid<VectorType>::v_cycle);
+
+  for (unsigned int i = minlevel; i <= maxlevel; ++i)
+    mg.defect[i].reinit(N);
+
+  MGLevelProfiler profiler(MPI_COMM_SELF);
+  profiler.connect(mg);
+
+  deallog << "Three V-cycles on levels " << minlevel << "-" << maxlevel
+          << std::endl;
+  for (unsigned int i = 0; i < 3; ++i)
+    mg.cycle();
+  print_calls(profiler, maxlevel);
+
+  deallog << "One W-cycle after reset" << std::endl;
+  profiler.reset();
+  mg.set_cycle(Multigrid<VectorType>::w_cycle);
+  mg.cycle();
+  print_calls(profiler, maxlevel);
+
+  deallog << "Preconditioner with V-cycle after reset" << std::endl;
+  profiler.reset();
+  profiler.disconnect();
+
+  DoFHandler<2> dof_handler;
+
+  TransferToMGDummy transfer;
+
+  PreconditionMG<2, VectorType, TransferToMGDummy> preconditioner(dof_handler,
+                                                                  mg,
+                                                                  transfer);
+
+  VectorType dst(N), src(N);
+
+  mg.set_cycle(Multigrid<VectorType>::v_cycle);
+  profiler.connect(preconditioner);
+  preconditioner.vmult(dst, src);
+  print_calls(profiler, maxlevel);
+
+  profiler.disconnect();
+  mg.cycle();
+  deallog << "Calls on finest level after disconnect: "
+          << profiler.get_n_calls(MGLevelProfiler::Phase::pre_smoother_step,
+                                  maxlevel)
+          << std::endl;
+}
+
+int
+main()
+{
+  initlog();
+
+  test_profiler(0, 3);
+  test_profiler(2, 4);
+}
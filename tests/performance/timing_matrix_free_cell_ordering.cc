@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark that measures the reuse of vector entries in the
+// matrix-free cell loop depending on the order of the cells. The mesh is
+// created from a coarse mesh whose cells are numbered in a scrambled order,
+// as is typical for meshes from external mesh generators, and refined
+// globally. We time the application of a Laplace operator with Q2 elements
+// - with the default order of cells and the unknowns as enumerated by the
+//   DoFHandler,
+// - with the default order of cells and the unknowns renumbered by
+//   DoFRenumbering::matrix_free_data_locality(), and
+// - with the cells ordered along a Hilbert curve by
+//   MatrixFree::AdditionalData::order_cells_along_hilbert_curve and the
+//   unknowns renumbered by DoFRenumbering::matrix_free_data_locality().
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+static constexpr int dim       = 3;
+static constexpr int fe_degree = 2;
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+
+
+void
+create_scrambled_mesh(Triangulation<dim> &tria)
+{
+  unsigned int n_subdivisions = 0, n_refinements = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_subdivisions = 12;
+        n_refinements  = 2;
+        break;
+      case TestingEnvironment::medium:
+        n_subdivisions = 16;
+        n_refinements  = 2;
+        break;
+      case TestingEnvironment::heavy:
+        n_subdivisions = 16;
+        n_refinements  = 3;
+        break;
+    }
+
+  Triangulation<dim> structured;
+  GridGenerator::subdivided_hyper_cube(structured, n_subdivisions);
+
+  // permute the coarse cells with a stride that is coprime with the number
+  // of cells
+  std::vector<CellData<dim>> cells(structured.n_active_cells());
+  for (const auto &cell : structured.active_cell_iterators())
+    {
+      const unsigned int new_index =
+        (cell->active_cell_index() * 7919) % cells.size();
+      for (const unsigned int v : cell->vertex_indices())
+        cells[new_index].vertices.push_back(cell->vertex_index(v));
+    }
+  tria.create_triangulation(structured.get_vertices(), cells, SubCellData());
+  tria.refine_global(n_refinements);
+}
+
+
+
+double
+time_operator(DoFHandler<dim> &dof_handler,
+              const bool       renumber_dofs,
+              const bool       order_cells_along_hilbert_curve)
+{
+  dof_handler.distribute_dofs(dof_handler.get_fe());
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim, double>::AdditionalData::none;
+  data.order_cells_along_hilbert_curve = order_cells_along_hilbert_curve;
+
+  if (renumber_dofs)
+    DoFRenumbering::matrix_free_data_locality(dof_handler, constraints, data);
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe_degree + 1),
+                     data);
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  src = 1.;
+
+  const auto laplace_operator =
+    [](const MatrixFree<dim, double>               &matrix_free,
+       VectorType                                  &dst,
+       const VectorType                            &src,
+       const std::pair<unsigned int, unsigned int> &cell_range) {
+      FEEvaluation<dim, fe_degree> phi(matrix_free);
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate_scatter(EvaluationFlags::gradients, dst);
+        }
+    };
+
+  const unsigned int n_repetitions = 50;
+
+  // warm up
+  matrix_free.cell_loop<VectorType, VectorType>(laplace_operator,
+                                                dst,
+                                                src,
+                                                true);
+
+  Timer time;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    matrix_free.cell_loop<VectorType, VectorType>(laplace_operator,
+                                                dst,
+                                                src,
+                                                true);
+  return time.wall_time() / n_repetitions;
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"vmult_default_order",
+           "vmult_default_order_renumbered",
+           "vmult_hilbert_order_renumbered"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Triangulation<dim> tria;
+  create_scrambled_mesh(tria);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const double time_default = time_operator(dof_handler, false, false);
+  const double time_default_renumbered =
+    time_operator(dof_handler, true, false);
+  const double time_hilbert_renumbered = time_operator(dof_handler, true, true);
+
+  return {time_default, time_default_renumbered, time_hilbert_renumbered};
+}
@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception OR LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Detailed license information governing the source code and contributions
+// can be found in LICENSE.md and CONTRIBUTING.md at the top level directory.
+//
+// -----------------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark that measures the ghost exchange of
+// LinearAlgebra::distributed::Vector, i.e., update_ghost_values() and
+// compress(VectorOperation::add), with the default MPI point-to-point
+// communication and with the exchange through MPI-3 shared-memory windows
+// enabled by
+// LinearAlgebra::distributed::Vector::enable_shared_memory_ghost_exchange().
+// The ghost pattern mimics a three-dimensional domain decomposition where
+// each process imports one layer of unknowns from each of its two neighbors
+// in the process numbering as well as a few scattered entries from
+// processes further away.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <memory>
+
+#define ENABLE_MPI
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+std::shared_ptr<const Utilities::MPI::Partitioner>
+create_partitioner(const MPI_Comm comm)
+{
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  types::global_dof_index layer = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        layer = 64 * 64;
+        break;
+      case TestingEnvironment::medium:
+        layer = 96 * 96;
+        break;
+      case TestingEnvironment::heavy:
+        layer = 128 * 128;
+        break;
+    }
+  const types::global_dof_index local_size = layer * layer / 64;
+  const types::global_dof_index size       = local_size * n_procs;
+
+  IndexSet locally_owned(size);
+  locally_owned.add_range(local_size * my_rank, local_size * (my_rank + 1));
+
+  // one layer of unknowns from the left and right neighbor and a few
+  // scattered entries from processes further away
+  IndexSet ghosts(size);
+  if (my_rank > 0)
+    ghosts.add_range(local_size * my_rank - layer, local_size * my_rank);
+  if (my_rank + 1 < n_procs)
+    ghosts.add_range(local_size * (my_rank + 1),
+                     local_size * (my_rank + 1) + layer);
+  for (unsigned int p = 0; p < n_procs; p += 3)
+    if (p != my_rank)
+      for (types::global_dof_index i = 0; i < local_size; i += local_size / 8)
+        ghosts.add_index(local_size * p + i);
+
+  return std::make_shared<const Utilities::MPI::Partitioner>(locally_owned,
+                                                             ghosts,
+                                                             comm);
+}
+
+
+
+std::pair<double, double>
+time_exchange(const std::shared_ptr<const Utilities::MPI::Partitioner> &part,
+              const MPI_Comm comm_sm,
+              const bool     use_shared_memory)
+{
+  LinearAlgebra::distributed::Vector<double> vector;
+  vector.reinit(part, comm_sm);
+  if (use_shared_memory)
+    vector.enable_shared_memory_ghost_exchange();
+
+  for (unsigned int i = 0; i < vector.locally_owned_size(); ++i)
+    vector.local_element(i) = i;
+
+  const unsigned int n_repetitions = 100;
+
+  Timer time;
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    {
+      vector.update_ghost_values();
+      vector.zero_out_ghost_values();
+    }
+  const double time_update = time.wall_time() / n_repetitions;
+
+  time.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    {
+      for (unsigned int j = 0; j < part->n_ghost_indices(); ++j)
+        vector.local_element(part->locally_owned_size() + j) = 1.;
+      vector.compress(VectorOperation::add);
+    }
+  const double time_compress = time.wall_time() / n_repetitions;
+
+  return {time_update, time_compress};
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"update_ghost_values",
+           "compress",
+           "update_ghost_values_shared_memory",
+           "compress_shared_memory"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  MPI_Comm  comm_sm;
+  const int ierr = MPI_Comm_split_type(comm,
+                                       MPI_COMM_TYPE_SHARED,
+                                       Utilities::MPI::this_mpi_process(comm),
+                                       MPI_INFO_NULL,
+                                       &comm_sm);
+  AssertThrowMPI(ierr);
+
+  const auto partitioner = create_partitioner(comm);
+
+  const auto [update_default, compress_default] =
+    time_exchange(partitioner, comm_sm, false);
+  const auto [update_sm, compress_sm] =
+    time_exchange(partitioner, comm_sm, true);
+
+  Utilities::MPI::free_communicator(comm_sm);
+
+  return {update_default, compress_default, update_sm, compress_sm};
+}